@@ -1,6 +1,9 @@
 #include <Arduino.h>
 #include <EEPROM.h>
 #include <Adafruit_INA219.h>
+#include <Wire.h>
+#include "StorageConfiguration/EepromLayout.h"
+#include "StorageConfiguration/EepromJournal.h"
 
 struct BatteryStateManager {
     Adafruit_INA219 &ina;
@@ -12,18 +15,48 @@ struct BatteryStateManager {
     const float VOLT_DIFF_THRESHOLD = 0.20f; // >200mV difference → external charge/swap
 
     // ===== EEPROM layout =====
+    // Bản cũ (3 địa chỉ cố định) chỉ còn đọc để chuyển sang journal
     const uint16_t EEPROM_MAGIC = 0xBEEF;
-    const int ADDR_MAGIC        = 0;
+    const int ADDR_MAGIC        = EEPROM_BATTERY_ADDR;
     const int ADDR_HIGHEST_V    = ADDR_MAGIC + sizeof(uint16_t);
     const int ADDR_MAHUSED      = ADDR_HIGHEST_V + sizeof(float);
 
+    struct StateRecord {
+        float highestV;
+        int32_t uAhUsed;
+    };
+    EepromJournal journal{EEPROM_BATTERY_JOURNAL_ADDR, EEPROM_BATTERY_JOURNAL_SLOTS, sizeof(StateRecord)};
+
+    // ===== INA219 sampling =====
+    // Continuous shunt + bus, on-chip averaging: shunt 128 mẫu (68.1 ms) +
+    // bus 32 mẫu (17 ms) = 85 ms / vòng chuyển đổi < chu kỳ đọc 100 ms
+    // → mỗi lần đọc là trung bình mới, không phụ thuộc tốc độ loop().
+    // Dải 32 V / ±320 mV như setCalibration_32V_2A() của thư viện.
+    static const uint16_t SAMPLE_INTERVAL_MS = 100;     // 10 Hz
+    static const uint8_t  INA_REG_CONFIG     = 0x00;
+    static const uint16_t INA_CONFIG =
+        0x2000 |   // BRNG 32 V
+        0x1800 |   // PGA /8, ±320 mV
+        0x0680 |   // BADC 12-bit, 32 mẫu
+        0x0078 |   // SADC 12-bit, 128 mẫu
+        0x0007;    // shunt + bus, continuous
+    static const int32_t  UAMS_PER_UAH       = 3600000L; // µA·ms → µAh
+    static const uint16_t MAX_STEP_MS        = 500;      // giữ tích µA × ms trong int32
+
     // ===== Runtime state variables =====
     float highestRecordedVoltage = 0.0f;
-    float mAhUsed = 0.0f;               // Coulomb counter
-    uint32_t lastUpdateMs = 0;
+    float mAhUsed = 0.0f;               // Coulomb counter (= uAhUsed / 1000)
+    float lastCurrent_mA = 0.0f;        // lần đọc gần nhất (ParkGuard đo dòng idle)
+    uint32_t lastUpdateMs = 0;          // mốc lịch đọc 10 Hz
     uint32_t lastEepromSaveMs = 0;
     const uint32_t SAVE_INTERVAL_MS = 120000UL; // 2 minutes
 
+    // ===== Stats (cửa sổ 1 s) =====
+    uint16_t samplesPerSec = 0;
+    uint32_t updatesPerSec = 0;         // số lần update() = số lần đọc I2C trước đây
+    uint32_t i2cUsPerSec = 0;
+    uint32_t i2cSavedUsPerSec = 0;      // ước lượng: (updates - samples) × µs / lần đọc
+
     // Constructor
     BatteryStateManager(Adafruit_INA219 &inaRef, int &levelRef)
         : ina(inaRef), batteryLevel(levelRef) {}
@@ -53,31 +86,42 @@ struct BatteryStateManager {
             saveToEEPROM();
         }
 
+        configureIna();
+        lastCurrent_uA = (int32_t)lroundf(ina.getCurrent_mA() * 1000.0f);
+        lastCurrent_mA = lastCurrent_uA / 1000.0f;
+
         lastUpdateMs = millis();
+        lastSampleMs = lastUpdateMs;
+        statsStartMs = lastUpdateMs;
         lastEepromSaveMs = millis();
     }
 
     // ============================================================
-    //  RUNTIME LOGIC — called every loop()
+    //  RUNTIME LOGIC — called every loop(), đọc INA219 ở 10 Hz cố định
     // ============================================================
     void update() {
         uint32_t now = millis();
-        float currentVoltage = ina.getBusVoltage_V();
-        float current_mA = ina.getCurrent_mA(); // + discharge, - charge
+        updates++;
+        rollStats(now);
 
-        // Time delta (hours)
-        float deltaHours = 0;
-        if (lastUpdateMs > 0) {
-            deltaHours = (now - lastUpdateMs) / 3600000.0f;
-        }
-        lastUpdateMs = now;
+        if (now - lastUpdateMs < SAMPLE_INTERVAL_MS) return;
+        // giữ lịch 10 Hz; trễ quá 1 chu kỳ (ngủ, modem chặn) → bắt nhịp lại
+        lastUpdateMs += SAMPLE_INTERVAL_MS;
+        if (now - lastUpdateMs >= SAMPLE_INTERVAL_MS) lastUpdateMs = now;
 
-        // ---- COULOMB COUNTING ----
-        mAhUsed += current_mA * deltaHours;   // charging = negative current
+        uint32_t t0 = micros();
+        float currentVoltage = ina.getBusVoltage_V();
+        float current_mA = ina.getCurrent_mA(); // + discharge, - charge
+        i2cUsAcc += micros() - t0;
+        samples++;
+        lastCurrent_mA = current_mA;
 
-        // Clamp
-        if (mAhUsed < 0) mAhUsed = 0;
-        if (mAhUsed > MAX_MAH) mAhUsed = MAX_MAH;
+        // ---- COULOMB COUNTING (trapezoid, µA·ms) ----
+        int32_t current_uA = (int32_t)lroundf(current_mA * 1000.0f);
+        integrate(lastCurrent_uA, current_uA, now - lastSampleMs); // charging = negative current
+        lastCurrent_uA = current_uA;
+        lastSampleMs = now;
+        mAhUsed = uAhUsed / 1000.0f;
 
         // ---- UPDATE BATTERY LEVEL ----
         batteryLevel = computeSOCfromMah(mAhUsed);
@@ -87,14 +131,77 @@ struct BatteryStateManager {
             highestRecordedVoltage = currentVoltage;
         }
 
-        // ---- PERIODIC EEPROM SAVE ----
-        if (now - lastEepromSaveMs >= SAVE_INTERVAL_MS) {
-            saveToEEPROM();
+        // ---- PERIODIC EEPROM SAVE (nền, không chặn loop) ----
+        // journal còn bận → thử lại ở lần đọc sau
+        if (now - lastEepromSaveMs >= SAVE_INTERVAL_MS && saveToEEPROM()) {
             lastEepromSaveMs = now;
         }
     }
 
+    void printStats() {
+        Serial.print(F("[BAT] mAhUsed="));
+        Serial.print(mAhUsed, 2);
+        Serial.print(F(" samples/s="));
+        Serial.print(samplesPerSec);
+        Serial.print(F(" loops/s="));
+        Serial.print(updatesPerSec);
+        Serial.print(F(" i2c us/s="));
+        Serial.print(i2cUsPerSec);
+        Serial.print(F(" saved us/s="));
+        Serial.println(i2cSavedUsPerSec);
+        journal.printStats(F("battery"));
+    }
+
 private:
+    int32_t uAhUsed = 0;
+    int32_t residual_uAms = 0;          // phần lẻ < 1 µAh
+    int32_t lastCurrent_uA = 0;
+    uint32_t lastSampleMs = 0;
+
+    uint32_t statsStartMs = 0;
+    uint16_t samples = 0;
+    uint32_t updates = 0;
+    uint32_t i2cUsAcc = 0;
+
+    void configureIna() {
+        Wire.beginTransmission(INA219_ADDRESS);
+        Wire.write(INA_REG_CONFIG);
+        Wire.write((uint8_t)(INA_CONFIG >> 8));
+        Wire.write((uint8_t)(INA_CONFIG & 0xFF));
+        Wire.endTransmission();
+    }
+
+    // Hình thang giữa 2 mẫu; chia bước ≤ MAX_STEP_MS để avg × dt không tràn
+    // int32 (3.2 A × 500 ms = 1.6e9), phần nguyên µAh dồn vào uAhUsed.
+    void integrate(int32_t prev_uA, int32_t cur_uA, uint32_t dtMs) {
+        int32_t avg_uA = (prev_uA + cur_uA) / 2;
+        while (dtMs) {
+            uint16_t step = dtMs > MAX_STEP_MS ? MAX_STEP_MS : (uint16_t)dtMs;
+            dtMs -= step;
+            residual_uAms += avg_uA * (int32_t)step;
+            int32_t whole = residual_uAms / UAMS_PER_UAH;
+            residual_uAms -= whole * UAMS_PER_UAH;
+            uAhUsed += whole;
+        }
+
+        const int32_t maxUah = (int32_t)(MAX_MAH * 1000.0f);
+        if (uAhUsed < 0) { uAhUsed = 0; residual_uAms = 0; }
+        if (uAhUsed > maxUah) { uAhUsed = maxUah; residual_uAms = 0; }
+    }
+
+    void rollStats(uint32_t now) {
+        if (now - statsStartMs < 1000UL) return;
+        samplesPerSec = samples;
+        updatesPerSec = updates;
+        i2cUsPerSec = i2cUsAcc;
+        uint32_t usPerRead = samples ? i2cUsAcc / samples : 0;
+        i2cSavedUsPerSec = updates > samples ? (uint32_t)(updates - samples) * usPerRead : 0;
+        samples = 0;
+        updates = 0;
+        i2cUsAcc = 0;
+        statsStartMs = now;
+    }
+
 
     // ============================================================
     //  VOLTAGE → SOC estimation (startup only)
@@ -130,6 +237,7 @@ private:
         float soc = estimateSOC_FromVoltage(v);
         float remaining_mAh = (soc / 100.0f) * MAX_MAH;
         mAhUsed = MAX_MAH - remaining_mAh;
+        uAhUsed = (int32_t)lroundf(mAhUsed * 1000.0f);
 
         batteryLevel = soc;
         highestRecordedVoltage = v;
@@ -151,6 +259,24 @@ private:
     //  EEPROM HANDLING
     // ============================================================
     bool loadFromEEPROM() {
+        StateRecord r;
+        if (journal.begin(&r)) {
+            highestRecordedVoltage = r.highestV;
+            mAhUsed = r.uAhUsed / 1000.0f;
+        } else if (!loadLegacy()) {
+            return false;
+        }
+
+        if (highestRecordedVoltage < 0 || highestRecordedVoltage > 20) return false;
+        if (mAhUsed < 0 || mAhUsed > MAX_MAH) return false;
+
+        uAhUsed = (int32_t)lroundf(mAhUsed * 1000.0f);
+        return true;
+    }
+
+    // Vùng 3 địa chỉ cố định của firmware trước journal
+    bool loadLegacy() {
+        EepromLock lock;
         uint16_t magic;
         EEPROM.get(ADDR_MAGIC, magic);
 
@@ -160,17 +286,13 @@ private:
 
         EEPROM.get(ADDR_HIGHEST_V, highestRecordedVoltage);
         EEPROM.get(ADDR_MAHUSED, mAhUsed);
-
-        if (highestRecordedVoltage < 0 || highestRecordedVoltage > 20) return false;
-        if (mAhUsed < 0 || mAhUsed > MAX_MAH) return false;
-
         return true;
     }
 
-    void saveToEEPROM() {
-        uint16_t magic = EEPROM_MAGIC;
-        EEPROM.put(ADDR_MAGIC, magic);
-        EEPROM.put(ADDR_HIGHEST_V, highestRecordedVoltage);
-        EEPROM.put(ADDR_MAHUSED, mAhUsed);
+    bool saveToEEPROM() {
+        StateRecord r;
+        r.highestV = highestRecordedVoltage;
+        r.uAhUsed = uAhUsed;
+        return journal.append(&r);
     }
 };
\ No newline at end of file
@@ -9,7 +9,8 @@ enum class AlertType : uint8_t
     TOPPLE = 0,
     CRASH = 1,
     LOW_BATTERY = 2,
-    BOUNDARY_CROSS = 3
+    BOUNDARY_CROSS = 3,
+    THEFT = 4
 };
 
 inline const char *alertTypeToString(AlertType t)
@@ -24,6 +25,8 @@ inline const char *alertTypeToString(AlertType t)
         return "low_battery";
     case AlertType::BOUNDARY_CROSS:
         return "boundary_cross";
+    case AlertType::THEFT:
+        return "theft";
     }
     return "";
 }
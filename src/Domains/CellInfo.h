@@ -1,6 +1,7 @@
 #pragma once
 #include <Arduino.h>
 #include <stdint.h>
+#include "NetworkConfiguration/LocationApiConfiguration.h"
 
 struct CellInfo {
     int   mcc = 0;
@@ -67,25 +68,43 @@ struct CellInfo {
     }
 
     // ----------------------------------------------------------
-    // Build LocationAPI-compatible JSON
+    // Serialize LocationAPI-compatible JSON thẳng ra Print
+    // (socket, CountingPrint, Serial…) – không tạo String trung gian.
+    // Trả về số byte đã ghi.
     // ----------------------------------------------------------
-    String buildLocationApiJson() const {
-        String json = "{";
+    size_t printLocationApiJson(Print &out) const {
+        size_t n = 0;
 
-        json += "\"token\":\"pk.934c1ddee8ca7d8db926995b255c9f26\",";
-        json += "\"radio\":\"lte\",";
-        json += "\"mcc\":" + String(mcc) + ",";
-        json += "\"mnc\":" + String(mnc) + ",";
+        n += out.print(F("{\"token\":\""));
+        n += out.print(LOCATION_API_TOKEN_F);
+        n += out.print(F("\",\"radio\":\"lte\",\"mcc\":"));
+        n += out.print(mcc);
+        n += out.print(F(",\"mnc\":"));
+        n += out.print(mnc);
 
-        json += "\"cells\":[{";
-        json += "\"lac\":" + String(lac) + ",";
-        json += "\"cid\":" + String(cid) + ",";
-        json += "\"psc\":0";
-        json += "}],";
+        n += out.print(F(",\"cells\":[{\"lac\":"));
+        n += out.print(lac);
+        n += out.print(F(",\"cid\":"));
+        n += out.print(cid);
+        n += out.print(F(",\"psc\":0}],"));
 
-        json += "\"address\":1";
-        json += "}";
+        // không cần địa chỉ (chỉ dùng lat/lon) → response nhỏ hơn nhiều
+        n += out.print(F("\"address\":0}"));
 
-        return json;
+        return n;
     }
-};
\ No newline at end of file
+};
+
+// ----------------------------------------------------------
+// Printable adapter → HttpConfiguration::startHttpPostJson(url, body)
+// chạy dry-run lấy Content-Length rồi ghi body thẳng vào request.
+// ----------------------------------------------------------
+struct LocationApiRequestBody : public Printable {
+    const CellInfo &cell;
+
+    explicit LocationApiRequestBody(const CellInfo &c) : cell(c) {}
+
+    size_t printTo(Print &p) const override {
+        return cell.printLocationApiJson(p);
+    }
+};
@@ -2,6 +2,19 @@
 
 #include <Arduino.h>
 #include <stdint.h>
+#include "Domains/Bike.h"
+
+// Phổ rung trục đứng, trung bình các cửa sổ 128 mẫu (VibrationAnalyzer)
+static const uint8_t VIBRATION_BANDS = 8;
+
+struct VibrationSummary
+{
+  uint8_t windows;                 // số cửa sổ FFT đã gộp (bão hoà 255)
+  uint16_t roughness_mg;           // RMS gia tốc đứng, bỏ DC
+  uint8_t bands[VIBRATION_BANDS];  // năng lượng dải, 4·log2 + 1 (0 = không có)
+};
+
+static const uint8_t VIBRATION_SUMMARY_VERSION = 1;
 
 struct Telemetry
 {
@@ -19,6 +32,12 @@ struct Telemetry
   bool isCrashed;
   bool isOutOfBound;
   UsageState usageState;
+  int8_t linkRssiDbm = -128; // smoothed RSSI (dBm), -128 = unknown
+  uint8_t linkQuality = 0;   // LinkQuality (0 NONE .. 3 GOOD)
+  uint8_t linkRat = 0;       // LinkRat
+  uint8_t locationSource = 0; // LocationSource của longitude/latitude (0 NONE, 1 NEO, 2 MODEM, 3 CELL)
+  uint8_t vibrationVersion = 0; // 0 = không kèm VibrationSummary
+  VibrationSummary vibration;
 };
 
 // ---- helpers for little endian writes ----
@@ -109,5 +128,32 @@ inline int encodeTelemetry(const Telemetry &t, uint8_t *buffer)
   // 14) UsageStatus (1 byte)
   buffer[offset++] = static_cast<uint8_t>(t.usageState);
 
+  // 15) Link RSSI dBm (int8)
+  buffer[offset++] = static_cast<uint8_t>(t.linkRssiDbm);
+
+  // 16) Link quality (1 byte)
+  buffer[offset++] = t.linkQuality;
+
+  // 17) Link RAT (1 byte)
+  buffer[offset++] = t.linkRat;
+
+  // 18) Location source (1 byte)
+  buffer[offset++] = t.locationSource;
+
+  // 19) Vibration (tuỳ chọn, tần suất thấp): [version][len][fields].
+  //     Version sau chỉ thêm field vào cuối → backend đọc theo độ dài.
+  if (t.vibrationVersion != 0)
+  {
+    const VibrationSummary &v = t.vibration;
+    buffer[offset++] = t.vibrationVersion;
+    int lenAt = offset++;
+    buffer[offset++] = v.windows;
+    buffer[offset++] = (uint8_t)(v.roughness_mg & 0xFF);
+    buffer[offset++] = (uint8_t)(v.roughness_mg >> 8);
+    memcpy(buffer + offset, v.bands, VIBRATION_BANDS);
+    offset += VIBRATION_BANDS;
+    buffer[lenAt] = (uint8_t)(offset - lenAt - 1);
+  }
+
   return offset;
 }
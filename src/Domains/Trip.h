@@ -276,13 +276,43 @@ bool decodeTripValidationResponse(const uint8_t *buf,
 }
 
 
+// Tổng hợp chuyến đi do xe tự tính (TripSummaryAggregator)
+struct TripSummary
+{
+    uint32_t distance_m;
+    uint32_t duration_s;        // helmet tháo → cắm lại
+    uint32_t moving_s;          // thời gian có chạy (> 3 km/h)
+    uint16_t max_speed_kmh_x10;
+    uint16_t avg_speed_kmh_x10; // trung bình khi chạy = distance / moving
+    uint16_t energy_mah;        // từ coulomb counter BatteryStateManager
+    uint8_t  topple_alerts;
+    uint8_t  crash_alerts;
+    uint8_t  low_battery_alerts;
+    uint8_t  boundary_alerts;
+};
+
+// Version khối mở rộng của termination payload (0 = không gửi)
+static const uint8_t TRIP_SUMMARY_VERSION = 1;
+
 struct TripTerminationPayload
 {
     float end_lng;
     float end_lat;
+    uint8_t summary_version; // 0 = payload cũ (8 bytes)
+    TripSummary summary;
 };
 
+inline void writeUInt16LE(uint8_t *buf, uint16_t value, int &offset)
+{
+    buf[offset++] = (uint8_t)(value & 0xFF);
+    buf[offset++] = (uint8_t)(value >> 8);
+}
+
 // ---- Trip encoder (Arduino) ----
+// [0..7]  end_lng, end_lat (float32 LE) – giữ nguyên cho backend cũ
+// [8]     summary_version, [9] số byte khối summary, rồi các field
+//         TripSummary theo thứ tự khai báo (LE). Version sau chỉ được
+//         thêm field vào cuối → backend đọc theo độ dài, bỏ qua phần lạ.
 inline int encodeTripTerminationPayload(const TripTerminationPayload &t, uint8_t *buffer)
 {
     int offset = 0;
@@ -292,6 +322,26 @@ inline int encodeTripTerminationPayload(const TripTerminationPayload &t, uint8_t
     // 7) current_lat (float32 LE)
     writeFloat32LE(buffer, t.end_lat, offset);
 
+    if (t.summary_version == 0)
+        return offset;
+
+    buffer[offset++] = t.summary_version;
+    int lenAt = offset++;
+
+    const TripSummary &s = t.summary;
+    writeInt32LE(buffer, (int32_t)s.distance_m, offset);
+    writeInt32LE(buffer, (int32_t)s.duration_s, offset);
+    writeInt32LE(buffer, (int32_t)s.moving_s, offset);
+    writeUInt16LE(buffer, s.max_speed_kmh_x10, offset);
+    writeUInt16LE(buffer, s.avg_speed_kmh_x10, offset);
+    writeUInt16LE(buffer, s.energy_mah, offset);
+    buffer[offset++] = s.topple_alerts;
+    buffer[offset++] = s.crash_alerts;
+    buffer[offset++] = s.low_battery_alerts;
+    buffer[offset++] = s.boundary_alerts;
+
+    buffer[lenAt] = (uint8_t)(offset - lenAt - 1);
+
     return offset; // total bytes written
 }
 
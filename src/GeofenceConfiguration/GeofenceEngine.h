@@ -0,0 +1,405 @@
+#pragma once
+#include <Arduino.h>
+#include "GeofenceConfiguration/GeofenceZones.h"
+#include "MotionConfiguration/MotionEngine.h"
+
+#ifndef GEOFENCE_MAX_POLYGONS
+#define GEOFENCE_MAX_POLYGONS 32
+#endif
+
+#ifndef GEOFENCE_GRID_DIM
+#define GEOFENCE_GRID_DIM 8
+#endif
+
+#if GEOFENCE_MAX_POLYGONS > 32
+typedef uint64_t GeoMask;
+#else
+typedef uint32_t GeoMask;
+#endif
+
+/**
+ * GeofenceEngine
+ *
+ * Polygon ALLOWED / FORBIDDEN lấy từ một GeoZoneSource (PROGMEM build sẵn
+ * hoặc tile EEPROM tải qua MQTT – xem GeofenceTileStore).
+ *
+ *   1) grid thô GEOFENCE_GRID_DIM² (dựng lúc begin từ bbox) → chỉ xét
+ *      polygon có bbox chạm ô chứa điểm
+ *   2) bbox tính sẵn → loại nhanh
+ *   3) point-in-polygon (crossing) bằng nhân int32 trên toạ độ int16
+ *
+ * Mỗi lần check đầy đủ cũng tính khoảng cách (cận dưới) tới biên gần
+ * nhất. Chừng nào xe đi chưa hết khoảng đó thì không thể đã vượt biên
+ * → bỏ qua check. Hysteresis: trong dải HYSTERESIS_M quanh biên giữ
+ * nguyên trạng thái, đổi trạng thái cần CONFIRM_SAMPLES mẫu liên tiếp.
+ */
+class GeofenceEngine
+{
+public:
+    static const uint16_t HYSTERESIS_M    = 10;
+    static const uint8_t  CONFIRM_SAMPLES = 2;
+    static const uint32_t MM_PER_UNIT     = 1112; // 1e-5 độ vĩ ≈ 1.112 m
+
+    // ---------------- Stats ----------------
+    uint32_t checks       = 0;
+    uint32_t skipped      = 0; // bỏ qua nhờ khoảng cách tới biên
+    uint32_t gridRejects  = 0; // polygon bị loại bởi grid
+    uint32_t bboxRejects  = 0;
+    uint32_t pipTests     = 0;
+    uint32_t lastCheckUs  = 0;
+    uint32_t maxCheckUs   = 0;
+
+    explicit GeofenceEngine(const GeoZoneSource &zones) : src(&zones) {}
+
+    // -------------------------------------------------
+    // Dựng grid từ bbox (đọc nguồn polygon một lần)
+    // -------------------------------------------------
+    void begin()
+    {
+        polyCount = src->polygonCount();
+        if (polyCount > GEOFENCE_MAX_POLYGONS)
+        {
+            Serial.println(F("[GEOFENCE] too many polygons, extra ignored"));
+            polyCount = GEOFENCE_MAX_POLYGONS;
+        }
+
+        hasAllowed = false;
+        gridMinLat = gridMinLon = gridMaxLat = gridMaxLon = 0;
+        for (uint8_t i = 0; i < polyCount; ++i)
+        {
+            GeoPolygon p;
+            readPolygon(i, p);
+            int32_t a = p.originLat5 + p.minLat, b = p.originLon5 + p.minLon;
+            int32_t c = p.originLat5 + p.maxLat, d = p.originLon5 + p.maxLon;
+            if (i == 0 || a < gridMinLat) gridMinLat = a;
+            if (i == 0 || b < gridMinLon) gridMinLon = b;
+            if (i == 0 || c > gridMaxLat) gridMaxLat = c;
+            if (i == 0 || d > gridMaxLon) gridMaxLon = d;
+            if (p.type == GEO_ALLOWED)
+                hasAllowed = true;
+        }
+
+        cellLat = (gridMaxLat - gridMinLat) / GEOFENCE_GRID_DIM + 1;
+        cellLon = (gridMaxLon - gridMinLon) / GEOFENCE_GRID_DIM + 1;
+        memset(grid, 0, sizeof(grid));
+        allMask = 0;
+
+        for (uint8_t i = 0; i < polyCount; ++i)
+        {
+            GeoPolygon p;
+            readPolygon(i, p);
+            allMask |= ((GeoMask)1 << i);
+            uint8_t r0 = cellRow(p.originLat5 + p.minLat), r1 = cellRow(p.originLat5 + p.maxLat);
+            uint8_t c0 = cellCol(p.originLon5 + p.minLon), c1 = cellCol(p.originLon5 + p.maxLon);
+            for (uint8_t r = r0; r <= r1; ++r)
+                for (uint8_t c = c0; c <= c1; ++c)
+                    grid[r][c] |= ((GeoMask)1 << i);
+        }
+
+        // cos(lat) cho khoảng cách theo kinh độ (1 lần, vùng hoạt động nhỏ)
+        float midLat = (gridMinLat + gridMaxLat) * 0.5e-5f;
+        cosLatQ15 = (uint16_t)(cos(radians(midLat)) * 32768.0f);
+
+        Serial.print(F("[GEOFENCE] polygons="));
+        Serial.println(polyCount);
+    }
+
+    // -------------------------------------------------
+    // Vị trí mới. Trả true nếu trạng thái (đã xác nhận) vừa đổi.
+    // -------------------------------------------------
+    bool update(int32_t latE7, int32_t lonE7)
+    {
+        checks++;
+
+        // chưa thể vượt biên kể từ lần check đầy đủ trước → bỏ qua
+        if (hasLastCheck && pending == 0)
+        {
+            uint32_t movedMm = equirectDistanceMm(lastLatE7, lastLonE7, latE7, lonE7, cosLatQ15);
+            if (movedMm != UINT32_MAX && movedMm < safeRadiusMm)
+            {
+                skipped++;
+                return false;
+            }
+        }
+
+        uint32_t t0 = micros();
+        uint32_t edgeUnits = 0;
+        bool rawOutside = classify(latE7, lonE7, edgeUnits);
+        lastCheckUs = micros() - t0;
+        if (lastCheckUs > maxCheckUs)
+            maxCheckUs = lastCheckUs;
+
+        uint32_t edgeMm = edgeUnits * MM_PER_UNIT;
+        hasLastCheck = true;
+        lastLatE7 = latE7;
+        lastLonE7 = lonE7;
+        // vùng an toàn = khoảng tới biên trừ dải hysteresis
+        safeRadiusMm = (edgeMm > HYSTERESIS_M * 1000UL) ? edgeMm - HYSTERESIS_M * 1000UL : 0;
+
+        if (!hasState)
+        {
+            hasState = true;
+            outside = rawOutside;
+            return outside;
+        }
+
+        // sát biên → giữ trạng thái cũ
+        if (edgeMm < HYSTERESIS_M * 1000UL || rawOutside == outside)
+        {
+            pending = 0;
+            return false;
+        }
+
+        if (++pending < CONFIRM_SAMPLES)
+            return false;
+
+        pending = 0;
+        outside = rawOutside;
+        return true;
+    }
+
+    bool isOutside() const { return outside; }
+
+    // -------------------------------------------------
+    // Đổi nguồn / dữ liệu zone (tile mới). Giữ trạng thái trong/ngoài
+    // đã xác nhận, chỉ bỏ vùng an toàn cũ → lần update sau check đầy đủ.
+    // -------------------------------------------------
+    void setSource(const GeoZoneSource &zones)
+    {
+        src = &zones;
+        begin();
+        hasLastCheck = false;
+        safeRadiusMm = 0;
+        pending = 0;
+    }
+
+    // -------------------------------------------------
+    // Check đầy đủ (không hysteresis / skip). edgeUnits = cận dưới
+    // khoảng cách tới biên gần nhất (1e-5 độ vĩ).
+    // -------------------------------------------------
+    bool classify(int32_t latE7, int32_t lonE7, uint32_t &edgeUnits)
+    {
+        int32_t lat5 = roundDiv100(latE7);
+        int32_t lon5 = roundDiv100(lonE7);
+
+        bool inAllowed = false;
+        bool inForbidden = false;
+        GeoMask mask = 0;
+        uint32_t best;
+
+        if (lat5 < gridMinLat || lat5 > gridMaxLat || lon5 < gridMinLon || lon5 > gridMaxLon)
+        {
+            // ngoài mọi bbox: khoảng tới khung grid
+            best = gap(lat5, lon5, gridMinLat, gridMinLon, gridMaxLat, gridMaxLon);
+            gridRejects += polyCount;
+        }
+        else
+        {
+            uint8_t r = cellRow(lat5), c = cellCol(lon5);
+            mask = grid[r][c];
+
+            // polygon ngoài ô không thể gần hơn biên ô
+            best = UINT32_MAX;
+            if (mask != allMask)
+            {
+                int32_t cLat0 = gridMinLat + (int32_t)r * cellLat;
+                int32_t cLon0 = gridMinLon + (int32_t)c * cellLon;
+                best = cellBorderUnits(lat5, lon5, cLat0, cLon0, cLat0 + cellLat, cLon0 + cellLon);
+            }
+        }
+
+        for (uint8_t i = 0; i < polyCount; ++i)
+        {
+            if (!(mask & ((GeoMask)1 << i)))
+            {
+                if (mask)
+                    gridRejects++;
+                continue;
+            }
+
+            GeoPolygon p;
+            readPolygon(i, p);
+            int32_t py = lat5 - p.originLat5;
+            int32_t px = lon5 - p.originLon5;
+
+            if (py < p.minLat || py > p.maxLat || px < p.minLon || px > p.maxLon)
+            {
+                bboxRejects++;
+                uint32_t g = gap(py, px, p.minLat, p.minLon, p.maxLat, p.maxLon);
+                if (g < best)
+                    best = g;
+                continue;
+            }
+
+            pipTests++;
+            if (pointInPolygon(p, (int16_t)py, (int16_t)px, best))
+            {
+                if (p.type == GEO_ALLOWED)
+                    inAllowed = true;
+                else
+                    inForbidden = true;
+            }
+        }
+
+        edgeUnits = best;
+        return (hasAllowed && !inAllowed) || inForbidden;
+    }
+
+    void printStats()
+    {
+        Serial.print(F("[GEOFENCE] outside="));
+        Serial.print(outside);
+        Serial.print(F(" checks="));
+        Serial.print(checks);
+        Serial.print(F(" skipped="));
+        Serial.print(skipped);
+        Serial.print(F(" gridRej="));
+        Serial.print(gridRejects);
+        Serial.print(F(" bboxRej="));
+        Serial.print(bboxRejects);
+        Serial.print(F(" pip="));
+        Serial.print(pipTests);
+        Serial.print(F(" safe(m)="));
+        Serial.print(safeRadiusMm / 1000);
+        Serial.print(F(" lastUs="));
+        Serial.print(lastCheckUs);
+        Serial.print(F(" maxUs="));
+        Serial.println(maxCheckUs);
+    }
+
+private:
+    const GeoZoneSource *src;
+    uint8_t polyCount = 0;
+
+    GeoMask grid[GEOFENCE_GRID_DIM][GEOFENCE_GRID_DIM];
+    GeoMask allMask = 0;
+    int32_t gridMinLat = 0, gridMinLon = 0, gridMaxLat = 0, gridMaxLon = 0;
+    int32_t cellLat = 1, cellLon = 1;
+    uint16_t cosLatQ15 = 32768;
+    bool hasAllowed = false;
+
+    // trạng thái + skip
+    bool hasState = false;
+    bool outside = false;
+    uint8_t pending = 0;
+    bool hasLastCheck = false;
+    int32_t lastLatE7 = 0, lastLonE7 = 0;
+    uint32_t safeRadiusMm = 0;
+
+    void readPolygon(uint8_t i, GeoPolygon &out) const
+    {
+        src->readPolygon(i, out);
+    }
+
+    void readVertex(uint16_t i, int16_t &lat, int16_t &lon) const
+    {
+        src->readVertex(i, lat, lon);
+    }
+
+    static int32_t roundDiv100(int32_t v)
+    {
+        return (v >= 0) ? (v + 50) / 100 : (v - 50) / 100;
+    }
+
+    uint8_t cellRow(int32_t lat5) const
+    {
+        int32_t r = (lat5 - gridMinLat) / cellLat;
+        return (uint8_t)constrain(r, 0, GEOFENCE_GRID_DIM - 1);
+    }
+
+    uint8_t cellCol(int32_t lon5) const
+    {
+        int32_t c = (lon5 - gridMinLon) / cellLon;
+        return (uint8_t)constrain(c, 0, GEOFENCE_GRID_DIM - 1);
+    }
+
+    // kinh độ → cùng thang với vĩ độ
+    int32_t scaleLon(int32_t dLon) const
+    {
+        return (int32_t)(((int64_t)dLon * cosLatQ15) >> 15);
+    }
+
+    // cận dưới khoảng cách từ điểm (ngoài) tới một box: max của 2 khe trục
+    uint32_t gap(int32_t lat, int32_t lon, int32_t minLat, int32_t minLon,
+                 int32_t maxLat, int32_t maxLon) const
+    {
+        int32_t gy = (lat < minLat) ? minLat - lat : (lat > maxLat ? lat - maxLat : 0);
+        int32_t gx = (lon < minLon) ? minLon - lon : (lon > maxLon ? lon - maxLon : 0);
+        gx = scaleLon(gx);
+        return (uint32_t)max(gx, gy);
+    }
+
+    // khoảng từ điểm (trong ô) tới cạnh ô gần nhất
+    uint32_t cellBorderUnits(int32_t lat, int32_t lon, int32_t minLat, int32_t minLon,
+                             int32_t maxLat, int32_t maxLon) const
+    {
+        int32_t dy = min(lat - minLat, maxLat - lat);
+        int32_t dx = scaleLon(min(lon - minLon, maxLon - lon));
+        return (uint32_t)max((int32_t)0, min(dx, dy));
+    }
+
+    // -------------------------------------------------
+    // Crossing test + khoảng cách tới cạnh gần nhất (cập nhật best)
+    // -------------------------------------------------
+    bool pointInPolygon(const GeoPolygon &p, int16_t py, int16_t px, uint32_t &best) const
+    {
+        bool inside = false;
+        int16_t yj, xj;
+        src->beginVertices();
+        readVertex(p.firstVertex + p.vertexCount - 1, yj, xj);
+
+        for (uint8_t k = 0; k < p.vertexCount; ++k)
+        {
+            int16_t yi, xi;
+            readVertex(p.firstVertex + k, yi, xi);
+
+            if ((yi > py) != (yj > py))
+            {
+                // px < xi + (py - yi) * (xj - xi) / (yj - yi), không chia
+                int32_t lhs = (int32_t)(px - xi) * (yj - yi);
+                int32_t rhs = (int32_t)(py - yi) * (xj - xi);
+                if ((yj > yi) ? (lhs < rhs) : (lhs > rhs))
+                    inside = !inside;
+            }
+
+            uint32_t d = segmentDistance(py, px, yi, xi, yj, xj, best);
+            if (d < best)
+                best = d;
+
+            yj = yi;
+            xj = xi;
+        }
+        src->endVertices();
+        return inside;
+    }
+
+    // khoảng cách điểm–đoạn (đơn vị 1e-5 độ vĩ); lọc nhanh bằng bbox đoạn
+    uint32_t segmentDistance(int16_t py, int16_t px, int16_t ay, int16_t ax,
+                             int16_t by, int16_t bx, uint32_t best) const
+    {
+        int32_t gy = (py < min(ay, by)) ? min(ay, by) - py : (py > max(ay, by) ? py - max(ay, by) : 0);
+        int32_t gx = (px < min(ax, bx)) ? min(ax, bx) - px : (px > max(ax, bx) ? px - max(ax, bx) : 0);
+        if ((uint32_t)max(scaleLon(gx), gy) >= best)
+            return best; // không thể gần hơn
+
+        int32_t abx = scaleLon(bx - ax), aby = by - ay;
+        int32_t apx = scaleLon(px - ax), apy = py - ay;
+
+        int32_t dot = apx * abx + apy * aby;
+        int32_t len2 = abx * abx + aby * aby;
+
+        if (dot <= 0 || len2 == 0)
+            return isqrt32((uint32_t)(apx * apx + apy * apy));
+
+        if (dot >= len2)
+        {
+            int32_t bpx = scaleLon(px - bx), bpy = py - by;
+            return isqrt32((uint32_t)(bpx * bpx + bpy * bpy));
+        }
+
+        int32_t cross = apx * aby - apy * abx;
+        if (cross < 0)
+            cross = -cross;
+        return (uint32_t)cross / isqrt32((uint32_t)len2);
+    }
+};
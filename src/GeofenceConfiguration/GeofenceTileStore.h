@@ -0,0 +1,693 @@
+#pragma once
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <util/crc16.h>
+#include "StorageConfiguration/EepromLayout.h"
+#include "StorageConfiguration/EepromJournal.h"
+#include "GeofenceConfiguration/GeofenceZones.h"
+#include "GeofenceConfiguration/Geohash.h"
+
+#ifndef GEO_TILE_MAX_POLYGONS
+#define GEO_TILE_MAX_POLYGONS 16
+#endif
+
+// -----------------------------------------------------------
+// Header slot trong EEPROM (16 bytes), theo sau là data tile
+// -----------------------------------------------------------
+struct GeoTileHeader
+{
+    uint16_t magic;                     // != MAGIC → slot trống
+    char     geohash[GEOHASH_TILE_LEN]; // key tile
+    uint8_t  polyCount;
+    uint16_t version;                   // version server (0 = chưa có)
+    uint16_t dataLen;
+    uint16_t crc;                       // CRC-16 (avr-libc _crc_ccitt_update, init 0xFFFF) của data
+    uint16_t lruStamp;                  // khôi phục thứ tự LRU khi boot
+};
+
+// Data tile = chuỗi polygon, mỗi polygon: record 12 bytes + vertexCount
+// x GeoVertex (int16 lat, lon tương đối origin, đơn vị 1e-5 độ).
+// Mọi offset là bội của 4 → index đỉnh = (địa chỉ - EEPROM_GEO_TILE_ADDR) / 4.
+struct GeoTilePolygonRecord
+{
+    uint8_t  type;        // GeoZoneType
+    uint8_t  vertexCount;
+    uint16_t reserved;
+    int32_t  originLat5;
+    int32_t  originLon5;
+};
+
+// -----------------------------------------------------------
+// Message server → xe (topic geofence/tiles/<bike>), little-endian:
+//   [0]     kind
+//   [1..5]  geohash
+//   [6..7]  version mới
+//   [8..9]  CRC data mới
+//   FULL      : [10..11] dataLen, [12..] data
+//   DIFF      : [10..11] baseVersion, [12..13] newLen,
+//               [14..] ops {offset u16, n u8, n bytes} ghi đè lên data cũ
+//   UNCHANGED : hết (xe đã có version này)
+// Tile không có zone = FULL với dataLen 0.
+// -----------------------------------------------------------
+enum GeoTileMsgKind : uint8_t
+{
+    GEO_TILE_FULL      = 1,
+    GEO_TILE_DIFF      = 2,
+    GEO_TILE_UNCHANGED = 3
+};
+
+/**
+ * GeofenceTileStore
+ *
+ * Cache tile zone (key = geohash 5 ký tự) trong EEPROM, đồng bộ qua MQTT
+ * (GeofenceTileSyncTask). Vùng hoạt động đổi hàng tuần mà không phải
+ * nạp lại firmware; mỗi lần đổi chỉ tốn vài trăm byte (DIFF) hoặc 10
+ * byte mỗi tile (UNCHANGED).
+ *
+ * - Làm GeoZoneSource cho GeofenceEngine: bảng GeoPolygon (bbox tính
+ *   sẵn) trong RAM, đỉnh đọc thẳng từ EEPROM → check không bao giờ chờ
+ *   mạng.
+ * - SLOT_COUNT slot, LRU (stamp trong RAM, chỉ ghi EEPROM khi lưu tile).
+ * - Tile mới được dựng hoàn chỉnh trong buffer stage, kiểm CRC + cấu
+ *   trúc rồi mới ghi; chỉ ghi byte thay đổi. Mất điện giữa chừng → CRC
+ *   sai lúc boot → slot bị bỏ, lần sync sau tải FULL.
+ * - apply() (MQTT callback) chỉ dựng stage; service() gọi mỗi loop() ghi
+ *   tối đa 1 byte khi EEPROM rảnh (~3.4 ms / byte chạy nền) → slot 256 B
+ *   không chặn mqtt.loop() / scheduler / IMU ~0.9 s như ghi đồng bộ.
+ * - Cập nhật tile đang có: bản mới ghi sang slot khác (không phải slot
+ *   cũ, không phải tile xe đang đứng); slot cũ vẫn trong bảng polygon
+ *   tới khi ghi xong, finishCommit() đổi chỗ rồi xoá magic slot cũ →
+ *   covers() / GeofenceEngine không mất tile giữa lúc ghi. Mất điện
+ *   trước khi xoá → boot thấy 2 slot cùng geohash, giữ version mới.
+ */
+class GeofenceTileStore : public GeoZoneSource
+{
+public:
+    static const uint16_t SLOT_SIZE  = 256;
+    static const uint8_t  SLOT_COUNT = EEPROM_GEO_TILE_SIZE / SLOT_SIZE;
+    static const uint16_t DATA_MAX   = SLOT_SIZE - sizeof(GeoTileHeader);
+    static const uint16_t MAGIC      = 0x6E0F;
+
+    enum ApplyResult : uint8_t
+    {
+        APPLY_REJECTED,
+        APPLY_UNCHANGED,
+        APPLY_UPDATED
+    };
+
+    // ---------------- Stats ----------------
+    uint32_t fullUpdates   = 0;
+    uint32_t diffUpdates   = 0;
+    uint32_t unchanged     = 0;
+    uint32_t rejected      = 0; // sai format / version / CRC
+    uint32_t crcFailures   = 0;
+    uint32_t evictions     = 0;
+    uint32_t rxBytes       = 0;
+    uint32_t eepromWrites  = 0; // byte thực sự ghi
+    uint32_t blockingCommits = 0; // tile mới tới khi stage chưa ghi xong
+    uint8_t  droppedPolys  = 0; // vượt GEO_TILE_MAX_POLYGONS
+
+    // -------------------------------------------------
+    // Đọc header, kiểm CRC từng slot, dựng bảng polygon
+    // -------------------------------------------------
+    void begin()
+    {
+        EepromLock lock;
+        lruClock = 0;
+        uint8_t used = 0;
+
+        for (uint8_t i = 0; i < SLOT_COUNT; ++i)
+        {
+            GeoTileHeader h;
+            EEPROM.get(slotAddr(i), h);
+            slotVersion[i] = 0;
+            lruStamps[i] = 0;
+
+            if (h.magic != MAGIC || h.dataLen > DATA_MAX ||
+                h.crc != crcEeprom(dataAddr(i), h.dataLen))
+                continue;
+
+            memcpy(slotHash[i], h.geohash, GEOHASH_TILE_LEN);
+            slotVersion[i] = h.version;
+            lruStamps[i] = h.lruStamp ? h.lruStamp : 1;
+            if (lruStamps[i] > lruClock)
+                lruClock = lruStamps[i];
+            used++;
+        }
+
+        // commit bị ngắt sau header mới, trước khi xoá slot cũ
+        for (uint8_t i = 0; i < SLOT_COUNT; ++i)
+            for (uint8_t j = i + 1; j < SLOT_COUNT; ++j)
+                if (lruStamps[i] && lruStamps[j] &&
+                    memcmp(slotHash[i], slotHash[j], GEOHASH_TILE_LEN) == 0)
+                {
+                    uint8_t older = (int16_t)(slotVersion[j] - slotVersion[i]) > 0 ? i : j;
+                    lruStamps[older] = 0;
+                    used--;
+                }
+
+        renumber();
+        rebuild();
+
+        Serial.print(F("[GEOTILE] loaded tiles="));
+        Serial.print(used);
+        Serial.print(F(" polygons="));
+        Serial.println(count);
+    }
+
+    bool hasTiles() const
+    {
+        for (uint8_t i = 0; i < SLOT_COUNT; ++i)
+            if (lruStamps[i])
+                return true;
+        return false;
+    }
+
+    // Tile chứa điểm đã có trong cache? (đánh dấu dùng gần đây khi xe
+    // sang tile khác – gọi mỗi fix 1 Hz, không tăng clock mỗi lần)
+    bool covers(int32_t lat5, int32_t lon5)
+    {
+        char gh[GEOHASH_TILE_LEN];
+        geohashEncode(lat5, lon5, gh);
+        int8_t slot = findSlot(gh);
+        if (slot < 0)
+            return false;
+        if (slot != activeSlot)
+        {
+            activeSlot = slot;
+            touch(slot);
+        }
+        return true;
+    }
+
+    // version đang có (0 = chưa có) – dùng cho request sync
+    uint16_t versionOf(const char *gh)
+    {
+        int8_t slot = findSlot(gh);
+        if (slot < 0)
+            return 0;
+        touch(slot);
+        return slotVersion[slot];
+    }
+
+    bool busy() const { return stageSlot >= 0; }
+
+    // -------------------------------------------------
+    // Áp dụng một message tile (gọi từ MQTT callback). APPLY_UPDATED =
+    // tile đã vào stage; polygon đổi khi service() báo ghi xong.
+    // -------------------------------------------------
+    ApplyResult apply(const uint8_t *msg, uint16_t len)
+    {
+        rxBytes += len;
+
+        // stage chỉ có 1 → tile trước phải ghi xong (hiếm: task sync
+        // không pump MQTT khi busy())
+        if (busy())
+        {
+            blockingCommits++;
+            flush();
+        }
+
+        if (len < 10)
+            return reject(F("short message"));
+
+        uint8_t kind = msg[0];
+        const char *gh = (const char *)&msg[1];
+        uint16_t version = rd16(&msg[6]);
+        uint16_t crc = rd16(&msg[8]);
+        int8_t slot = findSlot(gh);
+
+        if (kind == GEO_TILE_UNCHANGED)
+        {
+            if (slot < 0 || slotVersion[slot] != version)
+                return reject(F("unchanged for unknown version"));
+            touch(slot);
+            unchanged++;
+            return APPLY_UNCHANGED;
+        }
+
+        uint8_t *buf = stage;
+        uint16_t newLen;
+
+        if (kind == GEO_TILE_FULL)
+        {
+            if (len < 12)
+                return reject(F("short FULL"));
+            newLen = rd16(&msg[10]);
+            if (newLen > DATA_MAX || (uint16_t)(12 + newLen) != len)
+                return reject(F("bad FULL length"));
+            memcpy(buf, &msg[12], newLen);
+        }
+        else if (kind == GEO_TILE_DIFF)
+        {
+            if (len < 14)
+                return reject(F("short DIFF"));
+            uint16_t baseVersion = rd16(&msg[10]);
+            newLen = rd16(&msg[12]);
+            if (slot < 0 || slotVersion[slot] != baseVersion)
+                return reject(F("DIFF base version mismatch"));
+            if (newLen > DATA_MAX)
+                return reject(F("bad DIFF length"));
+
+            // data cũ làm nền, phần mở rộng = 0 (CRC bắt lỗi nếu server thiếu op)
+            EepromLock lock;
+            GeoTileHeader h;
+            EEPROM.get(slotAddr(slot), h);
+            memset(buf, 0, DATA_MAX);
+            for (uint16_t i = 0; i < h.dataLen && i < newLen; ++i)
+                buf[i] = EEPROM.read(dataAddr(slot) + i);
+
+            uint16_t p = 14;
+            while (p < len)
+            {
+                if (p + 3 > len)
+                    return reject(F("truncated DIFF op"));
+                uint16_t off = rd16(&msg[p]);
+                uint8_t n = msg[p + 2];
+                p += 3;
+                if (off + n > newLen || p + n > len)
+                    return reject(F("DIFF op out of range"));
+                memcpy(&buf[off], &msg[p], n);
+                p += n;
+            }
+        }
+        else
+        {
+            return reject(F("unknown kind"));
+        }
+
+        if (crcBuffer(buf, newLen) != crc)
+        {
+            crcFailures++;
+            return reject(F("CRC mismatch"));
+        }
+
+        uint8_t polyCount;
+        if (!validate(buf, newLen, polyCount))
+            return reject(F("bad polygon data"));
+
+        // luôn ghi sang slot khác: slot cũ (nếu có) phục vụ tới khi xong
+        int8_t oldSlot = slot;
+        slot = victimSlot(oldSlot);
+
+        // victim rời bảng polygon trong lúc ghi (đỉnh đang bị ghi đè)
+        if (lruStamps[slot])
+        {
+            evictions++;
+            lruStamps[slot] = 0;
+            rebuild();
+        }
+
+        GeoTileHeader &h = stageHdr;
+        h.magic = MAGIC;
+        memcpy(h.geohash, gh, GEOHASH_TILE_LEN);
+        h.polyCount = polyCount;
+        h.version = version;
+        h.dataLen = newLen;
+        h.crc = crc;
+        h.lruStamp = lruClock + 1;
+        stageSlot = slot;
+        stageOldSlot = oldSlot;
+        stagePos = 0;
+
+        if (kind == GEO_TILE_FULL)
+            fullUpdates++;
+        else
+            diffUpdates++;
+
+        Serial.print(F("[GEOTILE] "));
+        Serial.print(kind == GEO_TILE_FULL ? F("FULL ") : F("DIFF "));
+        Serial.write((const uint8_t *)gh, GEOHASH_TILE_LEN);
+        Serial.print(F(" v"));
+        Serial.print(version);
+        Serial.print(F(" polys="));
+        Serial.print(polyCount);
+        Serial.println(F(" staged"));
+
+        return APPLY_UPDATED;
+    }
+
+    // -------------------------------------------------
+    // Gọi mỗi loop(): ghi tiếp stage, không chờ EEPROM. true khi bảng
+    // polygon vừa đổi (tile ghi xong, hoặc apply() bỏ 1 tile để lấy chỗ)
+    // → đặt lại nguồn cho GeofenceEngine
+    // -------------------------------------------------
+    bool service()
+    {
+        bool changed = tableChanged;
+        tableChanged = false;
+
+        if (!busy())
+            return changed;
+        // journal pin đang ghi / byte trước chưa xong → lần sau
+        if (EepromJournal::active || (EECR & _BV(EEPE)))
+            return changed;
+
+        EepromLock lock;
+        uint16_t total = stageTotal();
+        while (stagePos < total)
+        {
+            int addr;
+            uint8_t b = stageByte(stagePos, addr);
+            stagePos++;
+            if (EEPROM.read(addr) != b)
+            {
+                EEPROM.write(addr, b);   // EEPE = 0 → bắt đầu ghi rồi trả về ngay
+                eepromWrites++;
+                return changed;
+            }
+        }
+
+        finishCommit();
+        tableChanged = false;
+        return true;
+    }
+
+    // ---------------- GeoZoneSource ----------------
+    uint8_t polygonCount() const override { return count; }
+
+    void readPolygon(uint8_t i, GeoPolygon &out) const override
+    {
+        out = polys[i];
+    }
+
+    // Giữa beginVertices() / endVertices() journal đã dừng sẵn → lock ở
+    // readVertex() không phải chờ byte journal nào nữa
+    void beginVertices() const override { vertexResume = EepromLock::pause(); }
+    void endVertices() const override { EepromLock::release(vertexResume); }
+
+    void readVertex(uint16_t i, int16_t &lat, int16_t &lon) const override
+    {
+        EepromLock lock;
+        int addr = EEPROM_GEO_TILE_ADDR + (int)i * (int)sizeof(GeoVertex);
+        EEPROM.get(addr, lat);
+        EEPROM.get(addr + (int)sizeof(int16_t), lon);
+    }
+
+    void printStats()
+    {
+        uint8_t used = 0;
+        for (uint8_t i = 0; i < SLOT_COUNT; ++i)
+            if (lruStamps[i])
+                used++;
+
+        Serial.print(F("[GEOTILE] tiles="));
+        Serial.print(used);
+        Serial.print('/');
+        Serial.print(SLOT_COUNT);
+        Serial.print(F(" polys="));
+        Serial.print(count);
+        Serial.print(F(" full="));
+        Serial.print(fullUpdates);
+        Serial.print(F(" diff="));
+        Serial.print(diffUpdates);
+        Serial.print(F(" unchanged="));
+        Serial.print(unchanged);
+        Serial.print(F(" rejected="));
+        Serial.print(rejected);
+        Serial.print(F(" crcFail="));
+        Serial.print(crcFailures);
+        Serial.print(F(" evictions="));
+        Serial.print(evictions);
+        Serial.print(F(" rxBytes="));
+        Serial.print(rxBytes);
+        Serial.print(F(" eepromWrites="));
+        Serial.print(eepromWrites);
+        Serial.print(F(" blockingCommits="));
+        Serial.print(blockingCommits);
+        Serial.print(F(" dropped="));
+        Serial.println(droppedPolys);
+    }
+
+private:
+    uint16_t lruStamps[SLOT_COUNT] = {0}; // 0 = slot trống
+    uint16_t lruClock = 0;
+    int8_t   activeSlot = -1;             // tile chứa vị trí hiện tại
+    char     slotHash[SLOT_COUNT][GEOHASH_TILE_LEN];
+    uint16_t slotVersion[SLOT_COUNT] = {0};
+
+    GeoPolygon polys[GEO_TILE_MAX_POLYGONS];
+    uint8_t count = 0;
+    mutable bool vertexResume = false;   // EERIE trước beginVertices()
+
+    // tile đã kiểm, chờ service() ghi
+    uint8_t       stage[DATA_MAX];
+    GeoTileHeader stageHdr;
+    int8_t        stageSlot = -1;
+    int8_t        stageOldSlot = -1;   // bản cũ, bỏ khi ghi xong
+    uint16_t      stagePos = 0;
+    bool          tableChanged = false; // rebuild() từ lần service() trước
+
+    static int slotAddr(uint8_t slot) { return EEPROM_GEO_TILE_ADDR + slot * (int)SLOT_SIZE; }
+    static int dataAddr(uint8_t slot) { return slotAddr(slot) + (int)sizeof(GeoTileHeader); }
+
+    static uint16_t rd16(const uint8_t *p) { return (uint16_t)p[0] | ((uint16_t)p[1] << 8); }
+
+    ApplyResult reject(const __FlashStringHelper *why)
+    {
+        rejected++;
+        Serial.print(F("[GEOTILE] rejected: "));
+        Serial.println(why);
+        return APPLY_REJECTED;
+    }
+
+    static uint16_t crcBuffer(const uint8_t *p, uint16_t n)
+    {
+        uint16_t crc = 0xFFFF;
+        for (uint16_t i = 0; i < n; ++i)
+            crc = _crc_ccitt_update(crc, p[i]);
+        return crc;
+    }
+
+    static uint16_t crcEeprom(int addr, uint16_t n)
+    {
+        EepromLock lock;
+        uint16_t crc = 0xFFFF;
+        for (uint16_t i = 0; i < n; ++i)
+            crc = _crc_ccitt_update(crc, EEPROM.read(addr + i));
+        return crc;
+    }
+
+    // data + header slot mới + 2 byte magic của slot cũ (nếu có)
+    uint16_t stageTotal() const
+    {
+        return stageHdr.dataLen + sizeof(GeoTileHeader) +
+               (stageOldSlot >= 0 ? sizeof(stageHdr.magic) : 0);
+    }
+
+    // Byte thứ i của stage: data trước, header sau (header cũ + data mới
+    // → CRC sai → bỏ slot nếu mất điện giữa chừng), cuối cùng xoá magic
+    // slot cũ
+    uint8_t stageByte(uint16_t i, int &addr) const
+    {
+        if (i < stageHdr.dataLen)
+        {
+            addr = dataAddr(stageSlot) + i;
+            return stage[i];
+        }
+        i -= stageHdr.dataLen;
+        if (i < sizeof(GeoTileHeader))
+        {
+            addr = slotAddr(stageSlot) + i;
+            return ((const uint8_t *)&stageHdr)[i];
+        }
+        i -= sizeof(GeoTileHeader);
+        addr = slotAddr(stageOldSlot) + i;
+        return 0;
+    }
+
+    // Ghi đồng bộ phần còn lại của stage (EEPROM.update, đếm byte thực ghi)
+    void flush()
+    {
+        {
+            EepromLock lock;
+            uint16_t total = stageTotal();
+            for (; stagePos < total; ++stagePos)
+            {
+                int addr;
+                uint8_t b = stageByte(stagePos, addr);
+                if (EEPROM.read(addr) != b)
+                {
+                    EEPROM.write(addr, b);
+                    eepromWrites++;
+                }
+            }
+        }
+        finishCommit();
+    }
+
+    void finishCommit()
+    {
+        uint8_t slot = (uint8_t)stageSlot;
+        stageSlot = -1;
+
+        // đổi chỗ: slot cũ rời bảng, tile đang dùng chuyển sang slot mới
+        if (stageOldSlot >= 0)
+        {
+            lruStamps[stageOldSlot] = 0;
+            if (activeSlot == stageOldSlot)
+                activeSlot = slot;
+            stageOldSlot = -1;
+        }
+
+        memcpy(slotHash[slot], stageHdr.geohash, GEOHASH_TILE_LEN);
+        slotVersion[slot] = stageHdr.version;
+        touch(slot);
+        rebuild();
+
+        Serial.print(F("[GEOTILE] committed "));
+        Serial.write((const uint8_t *)stageHdr.geohash, GEOHASH_TILE_LEN);
+        Serial.print(F(" v"));
+        Serial.println(stageHdr.version);
+    }
+
+    // Cấu trúc polygon hợp lệ + bbox vừa int16 an toàn cho nhân 32-bit
+    static bool validate(const uint8_t *buf, uint16_t len, uint8_t &polyCount)
+    {
+        polyCount = 0;
+        uint16_t p = 0;
+        while (p < len)
+        {
+            if (p + sizeof(GeoTilePolygonRecord) > len)
+                return false;
+            GeoTilePolygonRecord rec;
+            memcpy(&rec, &buf[p], sizeof(rec));
+            p += sizeof(rec);
+
+            if (rec.type > GEO_FORBIDDEN || rec.vertexCount < 3 ||
+                p + rec.vertexCount * sizeof(GeoVertex) > len)
+                return false;
+
+            int16_t minLat = INT16_MAX, minLon = INT16_MAX, maxLat = INT16_MIN, maxLon = INT16_MIN;
+            for (uint8_t k = 0; k < rec.vertexCount; ++k)
+            {
+                GeoVertex v;
+                memcpy(&v, &buf[p], sizeof(v));
+                p += sizeof(v);
+                minLat = min(minLat, v.lat);
+                maxLat = max(maxLat, v.lat);
+                minLon = min(minLon, v.lon);
+                maxLon = max(maxLon, v.lon);
+            }
+            if ((int32_t)maxLat - minLat > 16383 || (int32_t)maxLon - minLon > 16383)
+                return false;
+            polyCount++;
+        }
+        return true;
+    }
+
+    // -------------------------------------------------
+    // Bảng GeoPolygon trong RAM từ mọi slot hợp lệ
+    // -------------------------------------------------
+    void rebuild()
+    {
+        EepromLock lock;
+        count = 0;
+        tableChanged = true;
+        droppedPolys = 0;
+
+        for (uint8_t s = 0; s < SLOT_COUNT; ++s)
+        {
+            if (!lruStamps[s])
+                continue;
+
+            GeoTileHeader h;
+            EEPROM.get(slotAddr(s), h);
+            int addr = dataAddr(s);
+            int end = addr + h.dataLen;
+
+            while (addr < end)
+            {
+                GeoTilePolygonRecord rec;
+                EEPROM.get(addr, rec);
+                addr += sizeof(rec);
+
+                if (count >= GEO_TILE_MAX_POLYGONS)
+                {
+                    droppedPolys++;
+                    addr += rec.vertexCount * (int)sizeof(GeoVertex);
+                    continue;
+                }
+
+                GeoPolygon &g = polys[count++];
+                g.originLat5 = rec.originLat5;
+                g.originLon5 = rec.originLon5;
+                g.firstVertex = (uint16_t)((addr - EEPROM_GEO_TILE_ADDR) / (int)sizeof(GeoVertex));
+                g.vertexCount = rec.vertexCount;
+                g.type = rec.type;
+                g.minLat = g.minLon = INT16_MAX;
+                g.maxLat = g.maxLon = INT16_MIN;
+
+                for (uint8_t k = 0; k < rec.vertexCount; ++k)
+                {
+                    int16_t lat, lon;
+                    readVertex(g.firstVertex + k, lat, lon);
+                    g.minLat = min(g.minLat, lat);
+                    g.maxLat = max(g.maxLat, lat);
+                    g.minLon = min(g.minLon, lon);
+                    g.maxLon = max(g.maxLon, lon);
+                }
+                addr += rec.vertexCount * (int)sizeof(GeoVertex);
+            }
+        }
+
+        if (droppedPolys)
+        {
+            Serial.print(F("[GEOTILE] polygon table full, dropped="));
+            Serial.println(droppedPolys);
+        }
+    }
+
+    int8_t findSlot(const char *gh) const
+    {
+        for (uint8_t i = 0; i < SLOT_COUNT; ++i)
+            if (lruStamps[i] && memcmp(slotHash[i], gh, GEOHASH_TILE_LEN) == 0)
+                return i;
+        return -1;
+    }
+
+    void touch(uint8_t slot)
+    {
+        if (lruClock == 0xFFFF)
+            renumber();
+        lruStamps[slot] = ++lruClock;
+    }
+
+    // Clock sắp tràn → đánh số lại 1..n giữ nguyên thứ tự (0 = slot trống)
+    void renumber()
+    {
+        uint16_t next = 1;
+        for (uint8_t rank = 0; rank < SLOT_COUNT; ++rank)
+        {
+            int8_t best = -1;
+            for (uint8_t i = 0; i < SLOT_COUNT; ++i)
+            {
+                if (lruStamps[i] < next)
+                    continue; // trống hoặc đã đánh số
+                if (best < 0 || lruStamps[i] < lruStamps[best])
+                    best = i;
+            }
+            if (best < 0)
+                break;
+            lruStamps[best] = next++;
+        }
+        lruClock = next - 1;
+    }
+
+    // Slot trống trước, không thì tile dùng lâu nhất; không bao giờ là
+    // `keep` (bản cũ của tile đang cập nhật) hay tile xe đang đứng
+    int8_t victimSlot(int8_t keep) const
+    {
+        int8_t victim = -1;
+        for (uint8_t i = 0; i < SLOT_COUNT; ++i)
+        {
+            if (i == keep || i == activeSlot)
+                continue;
+            if (lruStamps[i] == 0)
+                return i;
+            if (victim < 0 || lruStamps[i] < lruStamps[victim])
+                victim = i;
+        }
+        return victim;
+    }
+};
@@ -0,0 +1,95 @@
+#pragma once
+#include <Arduino.h>
+
+// -----------------------------------------------------------
+// Geofence data (PROGMEM)
+//
+// Toạ độ đơn vị 1e-5 độ (~1.1 m). Mỗi polygon có origin tuyệt đối,
+// đỉnh + bbox lưu dạng int16 tương đối so với origin → point-in-polygon
+// chỉ cần nhân 32-bit. Giới hạn: |toạ độ tương đối| ≤ 16383 (~180 km).
+// -----------------------------------------------------------
+enum GeoZoneType : uint8_t
+{
+    GEO_ALLOWED   = 0, // xe phải ở trong (ít nhất một) vùng này
+    GEO_FORBIDDEN = 1  // xe không được vào
+};
+
+struct GeoVertex
+{
+    int16_t lat;
+    int16_t lon;
+};
+
+struct GeoPolygon
+{
+    int32_t  originLat5;  // 1e-5 độ
+    int32_t  originLon5;
+    int16_t  minLat, minLon, maxLat, maxLon; // bbox (tương đối), tính sẵn
+    uint16_t firstVertex; // index trong mảng GeoVertex
+    uint8_t  vertexCount;
+    uint8_t  type;        // GeoZoneType
+};
+
+// -----------------------------------------------------------
+// Nguồn polygon cho GeofenceEngine: bảng PROGMEM build sẵn
+// (ProgmemZoneSource) hoặc tile tải qua MQTT (GeofenceTileStore).
+// Index đỉnh do từng nguồn tự định nghĩa (firstVertex + k).
+// -----------------------------------------------------------
+class GeoZoneSource
+{
+public:
+    virtual uint8_t polygonCount() const = 0;
+    virtual void readPolygon(uint8_t i, GeoPolygon &out) const = 0;
+    virtual void readVertex(uint16_t i, int16_t &lat, int16_t &lon) const = 0;
+
+    // Bao vòng đọc đỉnh của một polygon: nguồn EEPROM khoá 1 lần / polygon
+    // thay vì mỗi readVertex()
+    virtual void beginVertices() const {}
+    virtual void endVertices() const {}
+};
+
+class ProgmemZoneSource : public GeoZoneSource
+{
+public:
+    ProgmemZoneSource(const GeoPolygon *polygonsPgm, uint8_t count, const GeoVertex *verticesPgm)
+        : polys(polygonsPgm), count(count), verts(verticesPgm) {}
+
+    uint8_t polygonCount() const override { return count; }
+
+    void readPolygon(uint8_t i, GeoPolygon &out) const override
+    {
+        memcpy_P(&out, &polys[i], sizeof(GeoPolygon));
+    }
+
+    void readVertex(uint16_t i, int16_t &lat, int16_t &lon) const override
+    {
+        lat = (int16_t)pgm_read_word(&verts[i].lat);
+        lon = (int16_t)pgm_read_word(&verts[i].lon);
+    }
+
+private:
+    const GeoPolygon *polys;
+    uint8_t count;
+    const GeoVertex *verts;
+};
+
+// ===========================================================
+//  Service area (HUB-CXBN4HMN, Thủ Đức)
+// ===========================================================
+static const GeoVertex GEOFENCE_VERTICES[] PROGMEM = {
+    // 0: vùng hoạt động
+    {9500, 1000},
+    {9800, 6000},
+    {8500, 11000},
+    {5000, 12500},
+    {1000, 10500},
+    {0, 6000},
+    {1500, 1500},
+    {5500, 0},
+};
+
+static const GeoPolygon GEOFENCE_POLYGONS[] PROGMEM = {
+    {1080000L, 10670000L, 0, 0, 9800, 12500, 0, 8, GEO_ALLOWED},
+};
+
+static const uint8_t GEOFENCE_POLYGON_COUNT = sizeof(GEOFENCE_POLYGONS) / sizeof(GEOFENCE_POLYGONS[0]);
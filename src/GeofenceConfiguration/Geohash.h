@@ -0,0 +1,65 @@
+#pragma once
+#include <Arduino.h>
+
+// -----------------------------------------------------------
+// Geohash (base32) cho key tile geofence.
+//
+// Độ chính xác 5 ký tự: 12 bit vĩ + 13 bit kinh → ô ~4.9 x 4.9 km
+// (0.0439° mỗi chiều). Tính trên toạ độ nguyên 1e-5 độ, không float.
+// -----------------------------------------------------------
+static const uint8_t GEOHASH_TILE_LEN = 5;
+
+static const char GEOHASH_BASE32[] PROGMEM = "0123456789bcdefghjkmnpqrstuvwxyz";
+
+// out: GEOHASH_TILE_LEN ký tự, KHÔNG có '\0'
+static inline void geohashEncode(int32_t lat5, int32_t lon5, char *out)
+{
+    lat5 = constrain(lat5, -9000000L, 8999999L);
+    lon5 = constrain(lon5, -18000000L, 17999999L);
+
+    // chỉ số ô trên mỗi trục = floor((x - min) * 2^bits / range), khớp
+    // geohash chuẩn (float) kể cả sát biên ô
+    uint16_t latIdx = (uint16_t)(((int64_t)(lat5 + 9000000L) << 12) / 18000000L);
+    uint16_t lonIdx = (uint16_t)(((int64_t)(lon5 + 18000000L) << 13) / 36000000L);
+
+    // xen kẽ bit: kinh, vĩ, kinh, ... (25 bit)
+    uint8_t bit = 0;
+    for (uint8_t c = 0; c < GEOHASH_TILE_LEN; ++c)
+    {
+        uint8_t idx = 0;
+        for (uint8_t b = 0; b < 5; ++b, ++bit)
+        {
+            uint8_t v = (bit & 1) ? (latIdx >> (11 - bit / 2)) & 1
+                                  : (lonIdx >> (12 - bit / 2)) & 1;
+            idx = (idx << 1) | v;
+        }
+        out[c] = (char)pgm_read_byte(&GEOHASH_BASE32[idx]);
+    }
+}
+
+// -----------------------------------------------------------
+// Các tile cần có sẵn quanh vị trí: tile hiện tại + tile kề mà xe
+// cách biên < marginUnits (phải < nửa ô). Tối đa 4 (gần góc).
+// Trả số tile.
+// -----------------------------------------------------------
+static inline uint8_t geohashTilesAround(int32_t lat5, int32_t lon5, int32_t marginUnits,
+                                         char out[][GEOHASH_TILE_LEN])
+{
+    uint8_t n = 0;
+    for (int8_t dy = -1; dy <= 1; dy += 2)
+    {
+        for (int8_t dx = -1; dx <= 1; dx += 2)
+        {
+            char gh[GEOHASH_TILE_LEN];
+            geohashEncode(lat5 + dy * marginUnits, lon5 + dx * marginUnits, gh);
+
+            bool dup = false;
+            for (uint8_t i = 0; i < n; ++i)
+                if (memcmp(out[i], gh, GEOHASH_TILE_LEN) == 0)
+                    dup = true;
+            if (!dup)
+                memcpy(out[n++], gh, GEOHASH_TILE_LEN);
+        }
+    }
+    return n;
+}
@@ -1,20 +1,60 @@
 #pragma once
 #include <TinyGPSPlus.h>
+#include "GpsConfiguration/UbxNavPvtParser.h"
+#include "SerialConfiguration/BufferedUart.h"
+
+// NMEA: TinyGPSPlus (mặc định của module)
+// UBX_PVT: CFG-VALSET tắt NMEA, chỉ xuất UBX-NAV-PVT (binary, integer)
+enum class GpsMode : uint8_t
+{
+    NMEA,
+    UBX_PVT
+};
 
 struct GpsConfiguration
 {
     TinyGPSPlus gps;
-    HardwareSerial *serial = nullptr;
+    UbxNavPvtParser ubx;
+    BufferedUart *serial = nullptr;  // USART1, ring RX 256 B
+    GpsMode mode;
+    GpsMode requestedMode;
+    uint8_t navRateHz;
+
+    // ---------------- Benchmark (CPU cho parse) ----------------
+    uint32_t parseUs    = 0; // tổng µs trong update()
+    uint32_t parseBytes = 0;
+    uint32_t fixCount   = 0; // số lần vị trí mới (NMEA: location.isUpdated, UBX: NAV-PVT)
 
     // Constructor – chỉ nhận Serial, không nhận baud nữa
-    GpsConfiguration(HardwareSerial *s = nullptr)
-        : serial(s) {}
+    // navRateHz chỉ dùng cho UBX_PVT (1..10 Hz)
+    GpsConfiguration(BufferedUart *s = nullptr,
+                     GpsMode m = GpsMode::NMEA,
+                     uint8_t rateHz = 1)
+        : serial(s), mode(GpsMode::NMEA), requestedMode(m), navRateHz(rateHz) {}
 
     // Always use 38400 for NEO-M10
     void begin()
     {
-        if (serial)
-            serial->begin(38400);
+        if (!serial)
+            return;
+
+        serial->begin(38400);
+
+        if (requestedMode == GpsMode::UBX_PVT)
+        {
+            if (configureUbxPvt(navRateHz))
+            {
+                mode = GpsMode::UBX_PVT;
+                Serial.print(F("[GPS] UBX NAV-PVT mode @ "));
+                Serial.print(navRateHz);
+                Serial.println(F(" Hz"));
+            }
+            else
+            {
+                Serial.println(F("[GPS] CFG-VALSET not acked, staying on NMEA"));
+                mode = GpsMode::NMEA;
+            }
+        }
     }
 
     void update()
@@ -22,20 +62,115 @@ struct GpsConfiguration
         if (!serial)
             return;
 
-        while (serial->available() > 0)
+        uint32_t t0 = micros();
+        uint16_t n = 0;
+
+        if (mode == GpsMode::UBX_PVT)
         {
-            gps.encode(serial->read());
+            while (serial->available() > 0)
+            {
+                if (ubx.feed((uint8_t)serial->read()))
+                    fixCount++;
+                n++;
+            }
         }
+        else
+        {
+            while (serial->available() > 0)
+            {
+                gps.encode(serial->read());
+                n++;
+            }
+            if (gps.location.isUpdated())
+            {
+                fixCount++;
+                gps.location.lat(); // đọc để xoá cờ updated
+            }
+        }
+
+        if (n > 0)
+        {
+            parseUs += micros() - t0;
+            parseBytes += n;
+        }
+    }
+
+    // ===================================================
+    //  Fix API (giống nhau cho cả 2 mode)
+    // ===================================================
+
+    bool hasFix()
+    {
+        if (mode == GpsMode::UBX_PVT)
+            return ubx.pvtCount > 0 && ubx.pvt.gnssFixOk && ubx.pvt.fixType >= 2;
+        return gps.location.isValid();
+    }
+
+    // Toạ độ nguyên (deg * 1e-7)
+    bool getLocationE7(int32_t &latE7, int32_t &lonE7)
+    {
+        if (!hasFix())
+            return false;
+
+        if (mode == GpsMode::UBX_PVT)
+        {
+            latE7 = ubx.pvt.latE7;
+            lonE7 = ubx.pvt.lonE7;
+        }
+        else
+        {
+            const RawDegrees &la = gps.location.rawLat();
+            const RawDegrees &lo = gps.location.rawLng();
+            latE7 = (int32_t)la.deg * 10000000L + (int32_t)(la.billionths / 100);
+            lonE7 = (int32_t)lo.deg * 10000000L + (int32_t)(lo.billionths / 100);
+            if (la.negative) latE7 = -latE7;
+            if (lo.negative) lonE7 = -lonE7;
+        }
+        return true;
+    }
+
+    uint32_t fixAgeMs()
+    {
+        if (mode == GpsMode::UBX_PVT)
+            return millis() - ubx.lastPvtMs;
+        return gps.location.age();
+    }
+
+    // UBX: pDOP (NAV-PVT không có hDOP), NMEA: HDOP
+    uint16_t dopX100()
+    {
+        if (mode == GpsMode::UBX_PVT)
+            return ubx.pvt.pDopX100;
+        return gps.hdop.isValid() ? (uint16_t)min((int32_t)9999, gps.hdop.value()) : 9999;
+    }
+
+    uint8_t satellites()
+    {
+        if (mode == GpsMode::UBX_PVT)
+            return ubx.pvt.numSv;
+        return gps.satellites.isValid() ? (uint8_t)gps.satellites.value() : 0;
+    }
+
+    // Ground speed mm/s (-1 = không có)
+    int32_t groundSpeedMmS()
+    {
+        if (mode == GpsMode::UBX_PVT)
+            return hasFix() ? ubx.pvt.gSpeedMmS : -1;
+        if (!gps.speed.isValid())
+            return -1;
+        // TinyGPSPlus speed.value() = knots * 100
+        return (int32_t)((int64_t)gps.speed.value() * 5144 / 1000);
     }
 
     bool getLocation(float &lat, float &lng)
     {
         Serial.println("Getting location from GPS...");
 
-        if (gps.location.isValid())
+        int32_t latE7, lonE7;
+        if (getLocationE7(latE7, lonE7))
         {
-            lat = gps.location.lat();
-            lng = gps.location.lng();
+            lat = latE7 * 1e-7f;
+            lng = lonE7 * 1e-7f;
             Serial.print("FIX: ");
             Serial.print(lat, 6);
             Serial.print(", ");
@@ -49,6 +184,29 @@ struct GpsConfiguration
 
     void printDebug()
     {
+        if (mode == GpsMode::UBX_PVT)
+        {
+            Serial.print(F("[UBX] fixType="));
+            Serial.print(ubx.pvt.fixType);
+            Serial.print(F(" sv="));
+            Serial.print(ubx.pvt.numSv);
+            Serial.print(F(" lat="));
+            Serial.print(ubx.pvt.latE7);
+            Serial.print(F(" lon="));
+            Serial.print(ubx.pvt.lonE7);
+            Serial.print(F(" hAcc(mm)="));
+            Serial.print(ubx.pvt.hAccMm);
+            Serial.print(F(" gSpeed(mm/s)="));
+            Serial.print(ubx.pvt.gSpeedMmS);
+            Serial.print(F(" pvt="));
+            Serial.print(ubx.pvtCount);
+            Serial.print(F(" ckErr="));
+            Serial.print(ubx.ckErrors);
+            Serial.print(F(" age="));
+            Serial.println(fixAgeMs());
+            return;
+        }
+
         Serial.print("Satellites: ");
         if (gps.satellites.isValid())
             Serial.print(gps.satellites.value());
@@ -79,9 +237,67 @@ struct GpsConfiguration
         Serial.println();
     }
 
-    bool hasFix()
+    // CPU per fix: so sánh NMEA (TinyGPSPlus) với UBX NAV-PVT
+    void printBenchmark()
     {
-        return gps.location.isValid();
+        Serial.print(F("[GPS] mode="));
+        Serial.print(mode == GpsMode::UBX_PVT ? F("UBX") : F("NMEA"));
+        Serial.print(F(" bytes="));
+        Serial.print(parseBytes);
+        Serial.print(F(" fixes="));
+        Serial.print(fixCount);
+        Serial.print(F(" parseUs="));
+        Serial.print(parseUs);
+        Serial.print(F(" us/fix="));
+        Serial.print(fixCount ? parseUs / fixCount : 0);
+        Serial.print(F(" us/byte="));
+        Serial.println(parseBytes ? parseUs / parseBytes : 0);
+    }
+
+    void resetBenchmark()
+    {
+        parseUs = 0;
+        parseBytes = 0;
+        fixCount = 0;
+    }
+
+    // ===================================================
+    //  UBX-CFG-VALSET (RAM layer): UART1 chỉ UBX, NAV-PVT mỗi epoch
+    // ===================================================
+    bool configureUbxPvt(uint8_t rateHz, uint32_t ackTimeoutMs = 1000)
+    {
+        if (rateHz < 1)  rateHz = 1;
+        if (rateHz > 10) rateHz = 10;
+        uint16_t measMs = 1000 / rateHz;
+
+        // version, layers (0x01 = RAM), reserved[2], rồi các cặp key/value
+        uint8_t p[4 + 5 + 5 + 5 + 6 + 6];
+        uint8_t n = 0;
+        p[n++] = 0x00;
+        p[n++] = 0x01;
+        p[n++] = 0x00;
+        p[n++] = 0x00;
+        n = putKey(p, n, 0x10740001UL, 1, 1);      // CFG-UART1OUTPROT-UBX = 1
+        n = putKey(p, n, 0x10740002UL, 0, 1);      // CFG-UART1OUTPROT-NMEA = 0
+        n = putKey(p, n, 0x20910007UL, 1, 1);      // CFG-MSGOUT-UBX_NAV_PVT_UART1 = 1/epoch
+        n = putKey(p, n, 0x30210001UL, measMs, 2); // CFG-RATE-MEAS (ms)
+        n = putKey(p, n, 0x30210002UL, 1, 2);      // CFG-RATE-NAV = 1 meas/nav
+
+        ubx.clearAck();
+        sendUbx(UBX_CLASS_CFG, UBX_ID_CFG_VALSET, p, n);
+
+        uint32_t start = millis();
+        while (millis() - start < ackTimeoutMs)
+        {
+            while (serial->available() > 0)
+                ubx.feed((uint8_t)serial->read());
+
+            if (ubx.ackReceived)
+                return true;
+            if (ubx.nakReceived)
+                return false;
+        }
+        return false;
     }
 
     // Returns distance in METERS between 2 GPS coordinates
@@ -99,4 +315,39 @@ struct GpsConfiguration
 
         return R * c; // distance in meters
     }
+
+private:
+    static uint8_t putKey(uint8_t *p, uint8_t n, uint32_t key, uint16_t value, uint8_t size)
+    {
+        p[n++] = (uint8_t)(key);
+        p[n++] = (uint8_t)(key >> 8);
+        p[n++] = (uint8_t)(key >> 16);
+        p[n++] = (uint8_t)(key >> 24);
+        p[n++] = (uint8_t)(value);
+        if (size == 2)
+            p[n++] = (uint8_t)(value >> 8);
+        return n;
+    }
+
+    void sendUbx(uint8_t cls, uint8_t id, const uint8_t *payload, uint16_t len)
+    {
+        uint8_t hdr[6] = {UBX_SYNC1, UBX_SYNC2, cls, id,
+                          (uint8_t)(len & 0xFF), (uint8_t)(len >> 8)};
+        uint8_t ckA = 0, ckB = 0;
+        for (uint8_t i = 2; i < 6; ++i)
+        {
+            ckA += hdr[i];
+            ckB += ckA;
+        }
+        for (uint16_t i = 0; i < len; ++i)
+        {
+            ckA += payload[i];
+            ckB += ckA;
+        }
+
+        serial->write(hdr, sizeof(hdr));
+        serial->write(payload, len);
+        serial->write(ckA);
+        serial->write(ckB);
+    }
 };
\ No newline at end of file
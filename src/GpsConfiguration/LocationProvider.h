@@ -0,0 +1,290 @@
+#pragma once
+#include <Arduino.h>
+#include "GpsConfiguration/GpsConfiguration.h"
+
+// -----------------------------------------------------------
+// Nguồn của một fix (cur_lat / cur_lng) – gửi kèm telemetry
+// -----------------------------------------------------------
+enum class LocationSource : uint8_t
+{
+    NONE       = 0,
+    GNSS_NEO   = 1, // NEO-M10 trên Serial1
+    GNSS_MODEM = 2, // GNSS tích hợp của SIM7600 (AT+CGPSINFO)
+    CELL       = 3  // CPSI → UnwiredLabs / cell cache
+};
+
+struct LocationFix
+{
+    float          lat       = 0;
+    float          lng       = 0;
+    uint16_t       hdopX100  = 9999; // HDOP * 100 (9999 = không rõ)
+    uint8_t        satellites = 0;
+    uint32_t       fixMs     = 0;    // millis() lúc có fix
+    LocationSource source    = LocationSource::NONE;
+
+    uint32_t ageMs() const { return millis() - fixMs; }
+};
+
+// -----------------------------------------------------------
+// Provider interface: mỗi nguồn vị trí trả fix mới nhất (nếu có)
+// -----------------------------------------------------------
+class LocationProvider
+{
+public:
+    virtual ~LocationProvider() {}
+    virtual bool latestFix(LocationFix &out) = 0;
+    virtual LocationSource source() const = 0;
+};
+
+// -----------------------------------------------------------
+// NEO-M10 (GpsConfiguration: NMEA hoặc UBX NAV-PVT)
+// -----------------------------------------------------------
+class NeoGpsLocationProvider : public LocationProvider
+{
+public:
+    explicit NeoGpsLocationProvider(GpsConfiguration &gpsRef)
+        : gpsCfg(gpsRef) {}
+
+    bool latestFix(LocationFix &out) override
+    {
+        int32_t latE7, lonE7;
+        if (!gpsCfg.getLocationE7(latE7, lonE7))
+            return false;
+
+        out.lat        = latE7 * 1e-7f;
+        out.lng        = lonE7 * 1e-7f;
+        out.hdopX100   = gpsCfg.dopX100();
+        out.satellites = gpsCfg.satellites();
+        out.fixMs      = millis() - gpsCfg.fixAgeMs();
+        out.source     = LocationSource::GNSS_NEO;
+        return true;
+    }
+
+    LocationSource source() const override { return LocationSource::GNSS_NEO; }
+
+private:
+    GpsConfiguration &gpsCfg;
+};
+
+// -----------------------------------------------------------
+// SIM7600 GNSS: không tự gửi AT, ModemGnssPollTask (low priority,
+// qua scheduler) gửi AT+CGPSINFO rồi đẩy dòng kết quả vào đây.
+// -----------------------------------------------------------
+class ModemGnssLocationProvider : public LocationProvider
+{
+public:
+    // CGPSINFO không có HDOP → ước lượng bảo thủ (kém hơn NEO khi cả hai có fix)
+    static const uint16_t ASSUMED_HDOP_X100 = 250;
+    // NEO-M10 có fix liên tục chừng này → AT+CGPS=0 (GNSS modem ~40-60 mA)
+    static const uint32_t POWER_OFF_AFTER_MS = 30000;
+
+    bool powered = false;  // đã gửi AT+CGPS=1
+    bool hasFix  = false;
+    LocationFix fix;
+
+    uint32_t polls    = 0;
+    uint32_t fixPolls = 0;
+
+    // -------------------------------------------------
+    // +CGPSINFO: 1051.123456,N,10645.123456,E,181026,034512.0,12.3,0.0,
+    // Không có fix: +CGPSINFO: ,,,,,,,,
+    // lat = ddmm.mmmmmm, lon = dddmm.mmmmmm
+    // -------------------------------------------------
+    bool parseCgpsInfoLine(const String &line)
+    {
+        int idx = line.indexOf("+CGPSINFO:");
+        if (idx < 0)
+            return false;
+
+        polls++;
+
+        const char *p = line.c_str() + idx + 10;
+        while (*p == ' ')
+            p++;
+
+        if (*p == ',' || *p == 0)
+            return false; // chưa có fix
+
+        float lat = parseDegMin(p);
+        p = skipField(p);
+        if (*p == 'S')
+            lat = -lat;
+        p = skipField(p);
+
+        float lng = parseDegMin(p);
+        p = skipField(p);
+        if (*p == 'W')
+            lng = -lng;
+
+        if (lat == 0 && lng == 0)
+            return false;
+
+        fix.lat        = lat;
+        fix.lng        = lng;
+        fix.hdopX100   = ASSUMED_HDOP_X100;
+        fix.satellites = 0;
+        fix.fixMs      = millis();
+        fix.source     = LocationSource::GNSS_MODEM;
+        hasFix = true;
+        fixPolls++;
+        return true;
+    }
+
+    // Sau AT+CGPS=0: fix cũ không còn được cập nhật
+    void onPowerOff()
+    {
+        powered = false;
+        hasFix = false;
+    }
+
+    bool latestFix(LocationFix &out) override
+    {
+        if (!hasFix)
+            return false;
+        out = fix;
+        return true;
+    }
+
+    LocationSource source() const override { return LocationSource::GNSS_MODEM; }
+
+private:
+    // "1051.123456" → 10 + 51.123456 / 60 (tách phần độ để giữ độ chính xác float)
+    static float parseDegMin(const char *p)
+    {
+        const char *dot = p;
+        while (*dot && *dot != '.' && *dot != ',')
+            dot++;
+
+        int degDigits = (int)(dot - p) - 2;
+        if (degDigits <= 0)
+            return 0;
+
+        int deg = 0;
+        for (int i = 0; i < degDigits; ++i)
+            deg = deg * 10 + (p[i] - '0');
+
+        float minutes = atof(p + degDigits);
+        return deg + minutes / 60.0f;
+    }
+
+    static const char *skipField(const char *p)
+    {
+        while (*p && *p != ',')
+            p++;
+        if (*p == ',')
+            p++;
+        return p;
+    }
+};
+
+/**
+ * LocationArbiter
+ *
+ * Chọn fix tốt nhất trong các provider:
+ *   - bỏ fix cũ hơn MAX_FIX_AGE_MS
+ *   - điểm = HDOP*100 + age/100ms (10 s tuổi ≈ +1.0 HDOP), nhỏ hơn là tốt hơn
+ *   - hoà điểm → provider đăng ký trước (NEO) thắng
+ */
+class LocationArbiter
+{
+public:
+    static const uint8_t  MAX_PROVIDERS  = 3;
+    static const uint32_t MAX_FIX_AGE_MS = 10000;
+
+    LocationSource currentSource = LocationSource::NONE;
+
+    // ---------------- Stats ----------------
+    uint32_t fixesBySource[4] = {0}; // index = LocationSource
+    uint32_t sourceSwitches   = 0;
+    uint32_t noFixCount       = 0;
+
+    bool addProvider(LocationProvider *p)
+    {
+        if (!p || providerCount >= MAX_PROVIDERS)
+            return false;
+        providers[providerCount++] = p;
+        return true;
+    }
+
+    bool best(LocationFix &out)
+    {
+        bool found = false;
+        uint32_t bestScore = 0;
+
+        for (uint8_t i = 0; i < providerCount; ++i)
+        {
+            LocationFix f;
+            if (!providers[i]->latestFix(f))
+                continue;
+
+            uint32_t age = f.ageMs();
+            if (age > MAX_FIX_AGE_MS)
+                continue;
+
+            uint32_t score = (uint32_t)f.hdopX100 + age / 100;
+            if (!found || score < bestScore)
+            {
+                out = f;
+                bestScore = score;
+                found = true;
+            }
+        }
+
+        if (!found)
+        {
+            noFixCount++;
+            return false;
+        }
+
+        if (out.source != currentSource)
+        {
+            if (currentSource != LocationSource::NONE)
+                sourceSwitches++;
+            Serial.print(F("[LOC] source → "));
+            Serial.println(sourceName(out.source));
+            currentSource = out.source;
+        }
+        fixesBySource[(uint8_t)out.source]++;
+        return true;
+    }
+
+    // provider chính (đầu tiên) có fix còn mới không
+    bool primaryHasFix()
+    {
+        LocationFix f;
+        return providerCount > 0 &&
+               providers[0]->latestFix(f) &&
+               f.ageMs() <= MAX_FIX_AGE_MS;
+    }
+
+    static const char *sourceName(LocationSource s)
+    {
+        switch (s)
+        {
+        case LocationSource::GNSS_NEO:   return "NEO";
+        case LocationSource::GNSS_MODEM: return "MODEM";
+        case LocationSource::CELL:       return "CELL";
+        default:                         return "NONE";
+        }
+    }
+
+    void printStats()
+    {
+        Serial.print(F("[LOC] source="));
+        Serial.print(sourceName(currentSource));
+        Serial.print(F(" neo="));
+        Serial.print(fixesBySource[(uint8_t)LocationSource::GNSS_NEO]);
+        Serial.print(F(" modem="));
+        Serial.print(fixesBySource[(uint8_t)LocationSource::GNSS_MODEM]);
+        Serial.print(F(" cell="));
+        Serial.print(fixesBySource[(uint8_t)LocationSource::CELL]);
+        Serial.print(F(" noFix="));
+        Serial.print(noFixCount);
+        Serial.print(F(" switches="));
+        Serial.println(sourceSwitches);
+    }
+
+private:
+    LocationProvider *providers[MAX_PROVIDERS] = {nullptr};
+    uint8_t providerCount = 0;
+};
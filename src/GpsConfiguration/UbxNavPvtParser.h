@@ -0,0 +1,214 @@
+#pragma once
+#include <Arduino.h>
+
+// -----------------------------------------------------------
+// UBX framing
+//   B5 62 | class | id | len (LE u16) | payload | CK_A CK_B
+// Checksum: Fletcher-8 trên class..payload
+// -----------------------------------------------------------
+static const uint8_t UBX_SYNC1 = 0xB5;
+static const uint8_t UBX_SYNC2 = 0x62;
+
+static const uint8_t UBX_CLASS_NAV = 0x01;
+static const uint8_t UBX_ID_NAV_PVT = 0x07;
+static const uint8_t UBX_CLASS_ACK = 0x05;
+static const uint8_t UBX_ID_ACK_NAK = 0x00;
+static const uint8_t UBX_ID_ACK_ACK = 0x01;
+static const uint8_t UBX_CLASS_CFG = 0x06;
+static const uint8_t UBX_ID_CFG_VALSET = 0x8A;
+
+static const uint16_t UBX_NAV_PVT_LEN = 92;
+
+// Chỉ giữ tới hết pDOP (offset 76..77); phần sau vẫn vào checksum nhưng không lưu
+#define UBX_PVT_KEEP_BYTES 78
+
+// Kết quả NAV-PVT, toàn số nguyên (đơn vị gốc của u-blox)
+struct UbxPvt
+{
+    uint32_t iTowMs    = 0;
+    uint8_t  fixType   = 0;  // 0 none, 2 2D, 3 3D, 4 GNSS+DR
+    bool     gnssFixOk = false;
+    uint8_t  numSv     = 0;
+    int32_t  lonE7     = 0;  // deg * 1e-7
+    int32_t  latE7     = 0;
+    int32_t  hMslMm    = 0;
+    uint32_t hAccMm    = 0;
+    int32_t  gSpeedMmS = 0;  // ground speed mm/s
+    int32_t  headMotE5 = 0;  // heading of motion deg * 1e-5
+    uint16_t pDopX100  = 9999;
+};
+
+/**
+ * UbxNavPvtParser
+ *
+ * State machine từng byte, checksum tính trực tiếp khi nhận (không
+ * buffer cả frame). Payload NAV-PVT được ghi vào một buffer cố định
+ * rồi đọc field theo offset tại chỗ (LE, không sscanf / atof).
+ * Cũng bắt UBX-ACK-ACK / ACK-NAK cho CFG-VALSET.
+ */
+struct UbxNavPvtParser
+{
+    enum State : uint8_t
+    {
+        SYNC1,
+        SYNC2,
+        CLASS,
+        ID,
+        LEN1,
+        LEN2,
+        PAYLOAD,
+        CK_A,
+        CK_B
+    };
+
+    State    state = SYNC1;
+    uint8_t  msgClass = 0;
+    uint8_t  msgId = 0;
+    uint16_t msgLen = 0;
+    uint16_t idx = 0;
+    uint8_t  ckA = 0, ckB = 0;
+    uint8_t  payload[UBX_PVT_KEEP_BYTES];
+
+    UbxPvt   pvt;
+    uint32_t pvtCount    = 0; // NAV-PVT hợp lệ
+    uint32_t lastPvtMs   = 0; // millis() lúc nhận NAV-PVT cuối
+    uint32_t ckErrors    = 0;
+
+    // ACK cho CFG-VALSET gần nhất
+    bool ackReceived = false;
+    bool nakReceived = false;
+
+    // Trả về true khi vừa có một NAV-PVT mới
+    bool feed(uint8_t b)
+    {
+        switch (state)
+        {
+        case SYNC1:
+            if (b == UBX_SYNC1)
+                state = SYNC2;
+            return false;
+
+        case SYNC2:
+            state = (b == UBX_SYNC2) ? CLASS : (b == UBX_SYNC1 ? SYNC2 : SYNC1);
+            return false;
+
+        case CLASS:
+            msgClass = b;
+            ckA = b;
+            ckB = b;
+            state = ID;
+            return false;
+
+        case ID:
+            msgId = b;
+            addCk(b);
+            state = LEN1;
+            return false;
+
+        case LEN1:
+            msgLen = b;
+            addCk(b);
+            state = LEN2;
+            return false;
+
+        case LEN2:
+            msgLen |= (uint16_t)b << 8;
+            addCk(b);
+            idx = 0;
+            // frame lạ quá dài → bỏ, tránh kẹt khi lệch sync
+            if (msgLen > 512)
+                state = SYNC1;
+            else
+                state = (msgLen == 0) ? CK_A : PAYLOAD;
+            return false;
+
+        case PAYLOAD:
+            addCk(b);
+            if (idx < UBX_PVT_KEEP_BYTES)
+                payload[idx] = b;
+            if (++idx >= msgLen)
+                state = CK_A;
+            return false;
+
+        case CK_A:
+            if (b != ckA)
+            {
+                ckErrors++;
+                state = (b == UBX_SYNC1) ? SYNC2 : SYNC1;
+                return false;
+            }
+            state = CK_B;
+            return false;
+
+        case CK_B:
+            state = SYNC1;
+            if (b != ckB)
+            {
+                ckErrors++;
+                return false;
+            }
+            return onFrame();
+        }
+        return false;
+    }
+
+    void clearAck()
+    {
+        ackReceived = false;
+        nakReceived = false;
+    }
+
+private:
+    void addCk(uint8_t b)
+    {
+        ckA += b;
+        ckB += ckA;
+    }
+
+    uint16_t u2(uint8_t off) const
+    {
+        return (uint16_t)payload[off] | ((uint16_t)payload[off + 1] << 8);
+    }
+
+    uint32_t u4(uint8_t off) const
+    {
+        return (uint32_t)payload[off] |
+               ((uint32_t)payload[off + 1] << 8) |
+               ((uint32_t)payload[off + 2] << 16) |
+               ((uint32_t)payload[off + 3] << 24);
+    }
+
+    bool onFrame()
+    {
+        if (msgClass == UBX_CLASS_ACK && msgLen >= 2 &&
+            payload[0] == UBX_CLASS_CFG && payload[1] == UBX_ID_CFG_VALSET)
+        {
+            if (msgId == UBX_ID_ACK_ACK)
+                ackReceived = true;
+            else if (msgId == UBX_ID_ACK_NAK)
+                nakReceived = true;
+            return false;
+        }
+
+        if (msgClass != UBX_CLASS_NAV || msgId != UBX_ID_NAV_PVT ||
+            msgLen != UBX_NAV_PVT_LEN)
+            return false;
+
+        // offsets theo u-blox M10 interface description (UBX-NAV-PVT)
+        pvt.iTowMs    = u4(0);
+        pvt.fixType   = payload[20];
+        pvt.gnssFixOk = (payload[21] & 0x01) != 0;
+        pvt.numSv     = payload[23];
+        pvt.lonE7     = (int32_t)u4(24);
+        pvt.latE7     = (int32_t)u4(28);
+        pvt.hMslMm    = (int32_t)u4(36);
+        pvt.hAccMm    = u4(40);
+        pvt.gSpeedMmS = (int32_t)u4(60);
+        pvt.headMotE5 = (int32_t)u4(64);
+        pvt.pDopX100  = u2(76);
+
+        pvtCount++;
+        lastPvtMs = millis();
+        return true;
+    }
+};
@@ -0,0 +1,364 @@
+#pragma once
+#include <Arduino.h>
+#include "ImuConfiguration/ImuSample.h"
+#include "MotionConfiguration/MotionEngine.h"
+
+#ifndef CRASH_TRACE_BYTES
+#define CRASH_TRACE_BYTES 512
+#endif
+
+// -----------------------------------------------------------
+// Trace va chạm (gửi kèm alert CRASH):
+//   [0] TRACE_VERSION          [1] rate (Hz)       [2] LSB / g
+//   [3] số mẫu trước va chạm   [4..5] tổng số mẫu (u16 LE)
+//   [6..7] peak (centi-g)      [8..9] jerk max (g/s)
+//   [10] cos(góc lệch hướng trọng lực trước / sau) x100 (int8)
+//   [11] flags: bit0 jerk, bit1 đổi hướng, bit2 bị cắt do đầy buffer
+//   rồi mỗi mẫu: zigzag-varint dX, dY, dZ (mẫu đầu: giá trị tuyệt đối)
+// Mẫu 50 Hz (trung bình các mẫu thô), 1/32 g → ~1 byte / trục khi
+// chạy bình thường, ~450 B cho 1 s trước + 2 s sau.
+// -----------------------------------------------------------
+
+/**
+ * CrashDetector
+ *
+ * Chạy trên từng mẫu thô của FIFO (không lọc), chi phí cố định mỗi mẫu:
+ *   - kích hoạt khi |a|² ≥ PEAK_G² (so bình phương, không sqrt)
+ *   - jerk: tổng |Δa| giữa 2 mẫu liên tiếp ≥ JERK_G_PER_S trong ±50 ms
+ *     quanh lúc kích hoạt (ổ gà / va nhẹ thường có peak nhưng jerk thấp)
+ *   - đổi hướng: hướng trọng lực (low-pass trước va chạm) so với trung
+ *     bình 0.5 s cuối cửa sổ sau → lệch > 45° (xe ngã / lật)
+ * Đủ cả ba → hasEvent(); trace (1 s trước + 2 s sau) nằm sẵn trong
+ * buffer tới khi clearEvent(). Sự kiện không đạt bị đếm theo lý do.
+ */
+class CrashDetector
+{
+public:
+    static const uint8_t  TRACE_VERSION   = 1;
+    static const uint8_t  TRACE_RATE_HZ   = 50;
+    static const uint8_t  TRACE_SHIFT     = 6;     // 2048 LSB/g → 32 LSB/g
+    static const uint8_t  DECIM           = IMU_SAMPLE_RATE_HZ / TRACE_RATE_HZ;
+    static const uint8_t  DECIM_SHIFT     = (DECIM == 4) ? 2 : 1;
+    static const uint8_t  PRE_SAMPLES     = TRACE_RATE_HZ;          // 1 s trước
+    static const uint16_t POST_SAMPLES    = 2 * IMU_SAMPLE_RATE_HZ; // 2 s sau (mẫu thô)
+    static const uint8_t  SETTLE_SAMPLES  = IMU_SAMPLE_RATE_HZ / 2; // hướng sau va chạm
+    static const uint8_t  HEADER_BYTES    = 12;
+
+    static const uint8_t  PEAK_G          = 4;
+    static const uint16_t JERK_G_PER_S    = 150;
+    static const uint8_t  JERK_WINDOW     = IMU_SAMPLE_RATE_HZ / 20; // ±50 ms
+    static const uint8_t  GRAVITY_SHIFT   = 6;     // low-pass τ ≈ 64 mẫu
+    static const uint8_t  ORIENT_COS2_X100 = 50;   // cos²(45°)
+
+    static const uint32_t PEAK_THR_SQ = (uint32_t)PEAK_G * IMU_ACCEL_LSB_PER_G *
+                                        PEAK_G * IMU_ACCEL_LSB_PER_G;
+    static const uint16_t JERK_THR    = (uint32_t)JERK_G_PER_S * IMU_ACCEL_LSB_PER_G / IMU_SAMPLE_RATE_HZ;
+
+    // ---------------- Stats ----------------
+    uint32_t triggers = 0;
+    uint32_t crashes = 0;
+    uint32_t rejectedJerk = 0;
+    uint32_t rejectedOrientation = 0;
+    uint32_t missed = 0;          // kích hoạt khi event trước chưa được lấy
+    uint16_t lastPeakCg = 0;
+    uint16_t lastJerkGps = 0;
+    int8_t   lastCosX100 = 100;
+
+    // -------------------------------------------------
+    // Một mẫu thô (IMU_SAMPLE_RATE_HZ, IMU_ACCEL_LSB_PER_G)
+    // -------------------------------------------------
+    void onSample(const ImuSample &s)
+    {
+        sampleIdx++;
+
+        uint32_t magSq = (uint32_t)((int32_t)s.ax * s.ax) +
+                         (uint32_t)((int32_t)s.ay * s.ay) +
+                         (uint32_t)((int32_t)s.az * s.az);
+        uint32_t jerk = 0;
+        if (primed)
+            jerk = (uint32_t)abs((int32_t)s.ax - prevAx) +
+                   (uint32_t)abs((int32_t)s.ay - prevAy) +
+                   (uint32_t)abs((int32_t)s.az - prevAz);
+        prevAx = s.ax;
+        prevAy = s.ay;
+        prevAz = s.az;
+
+        if (jerk >= JERK_THR)
+        {
+            lastJerkIdx = sampleIdx;
+            lastJerk = jerk;
+        }
+
+        if (!primed)
+        {
+            gravX = (int32_t)s.ax << GRAVITY_SHIFT;
+            gravY = (int32_t)s.ay << GRAVITY_SHIFT;
+            gravZ = (int32_t)s.az << GRAVITY_SHIFT;
+            primed = true;
+        }
+
+        if (!capturing)
+        {
+            gravX += s.ax - (gravX >> GRAVITY_SHIFT);
+            gravY += s.ay - (gravY >> GRAVITY_SHIFT);
+            gravZ += s.az - (gravZ >> GRAVITY_SHIFT);
+
+            if (magSq >= PEAK_THR_SQ)
+            {
+                if (eventPending)
+                    missed++;
+                else
+                    startCapture(magSq);
+            }
+        }
+        else
+        {
+            uint16_t elapsed = (uint16_t)(sampleIdx - triggerIdx);
+
+            if (magSq > peakMagSq)
+                peakMagSq = magSq;
+            if (jerk > maxJerk)
+                maxJerk = jerk;
+            if (jerk >= JERK_THR && elapsed <= JERK_WINDOW)
+                jerkSeen = true;
+
+            if (elapsed > POST_SAMPLES - SETTLE_SAMPLES)
+            {
+                settleX += s.ax;
+                settleY += s.ay;
+                settleZ += s.az;
+            }
+        }
+
+        feedTrace(s);
+
+        if (capturing && (uint16_t)(sampleIdx - triggerIdx) >= POST_SAMPLES)
+            finishCapture();
+    }
+
+    bool isCapturing() const { return capturing; }
+    bool hasEvent() const { return eventPending && !eventSending; }
+    const uint8_t *trace() const { return traceBuf; }
+    uint16_t traceLength() const { return traceLen; }
+
+    // Alert đang stream thẳng từ trace() → không báo lại, buffer vẫn giữ
+    void markSending() { eventSending = true; }
+
+    // Gọi khi alert đã gửi xong (hoặc bỏ) → nhận sự kiện mới
+    void clearEvent()
+    {
+        eventPending = false;
+        eventSending = false;
+    }
+
+    void printStats()
+    {
+        Serial.print(F("[CRASH] triggers="));
+        Serial.print(triggers);
+        Serial.print(F(" crashes="));
+        Serial.print(crashes);
+        Serial.print(F(" rejected jerk/orient="));
+        Serial.print(rejectedJerk);
+        Serial.print('/');
+        Serial.print(rejectedOrientation);
+        Serial.print(F(" missed="));
+        Serial.print(missed);
+        Serial.print(F(" last peak(cg)="));
+        Serial.print(lastPeakCg);
+        Serial.print(F(" jerk(g/s)="));
+        Serial.print(lastJerkGps);
+        Serial.print(F(" cos(x100)="));
+        Serial.print(lastCosX100);
+        Serial.print(F(" trace(B)="));
+        Serial.println(traceLen);
+    }
+
+private:
+    uint32_t sampleIdx = 0;
+    bool primed = false;
+    int16_t prevAx = 0, prevAy = 0, prevAz = 0;
+    uint32_t lastJerkIdx = 0;
+    uint32_t lastJerk = 0;
+    int32_t gravX = 0, gravY = 0, gravZ = 0;   // << GRAVITY_SHIFT
+
+    // ---- cửa sổ sau va chạm ----
+    bool capturing = false;
+    bool eventPending = false;
+    bool eventSending = false;
+    bool jerkSeen = false;
+    uint32_t triggerIdx = 0;
+    uint32_t peakMagSq = 0;
+    uint32_t maxJerk = 0;
+    int32_t settleX = 0, settleY = 0, settleZ = 0;
+
+    // ---- trace ----
+    int16_t decSum[3] = {0, 0, 0};
+    uint8_t decCount = 0;
+    int8_t  preRing[PRE_SAMPLES][3];          // 1 s trước, ±4 g
+    uint8_t preHead = 0;
+    uint8_t preCount = 0;
+    uint8_t traceBuf[CRASH_TRACE_BYTES];
+    uint16_t traceLen = 0;
+    uint16_t traceSamples = 0;
+    int16_t tracePrev[3] = {0, 0, 0};
+    bool truncated = false;
+
+    void startCapture(uint32_t magSq)
+    {
+        triggers++;
+        capturing = true;
+        triggerIdx = sampleIdx;
+        peakMagSq = magSq;
+        jerkSeen = (sampleIdx - lastJerkIdx) <= JERK_WINDOW && lastJerk >= JERK_THR;
+        maxJerk = jerkSeen ? lastJerk : 0;
+        settleX = settleY = settleZ = 0;
+
+        // header điền lúc chốt; dồn 1 s trước (theo thứ tự thời gian)
+        traceLen = HEADER_BYTES;
+        traceSamples = 0;
+        tracePrev[0] = tracePrev[1] = tracePrev[2] = 0;
+        truncated = false;
+
+        uint8_t idx = (preHead + PRE_SAMPLES - preCount) % PRE_SAMPLES;
+        for (uint8_t i = 0; i < preCount; ++i)
+        {
+            appendTrace(preRing[idx][0], preRing[idx][1], preRing[idx][2]);
+            idx = (idx + 1) % PRE_SAMPLES;
+        }
+        traceBuf[3] = preCount;
+    }
+
+    void finishCapture()
+    {
+        capturing = false;
+
+        // hướng trọng lực trước / sau, thang 128 LSB/g để tích không tràn
+        int32_t bx = gravX >> (GRAVITY_SHIFT + 4);
+        int32_t by = gravY >> (GRAVITY_SHIFT + 4);
+        int32_t bz = gravZ >> (GRAVITY_SHIFT + 4);
+        int32_t ax = settleX / SETTLE_SAMPLES;
+        int32_t ay = settleY / SETTLE_SAMPLES;
+        int32_t az = settleZ / SETTLE_SAMPLES;
+
+        int32_t dot = bx * (ax >> 4) + by * (ay >> 4) + bz * (az >> 4);
+        int32_t n1 = bx * bx + by * by + bz * bz;
+        int32_t n2 = (ax >> 4) * (ax >> 4) + (ay >> 4) * (ay >> 4) + (az >> 4) * (az >> 4);
+
+        // lệch > 45°  ⇔  dot ≤ 0 hoặc dot² < cos²45 · |b|²|a|²
+        bool orientChanged = dot <= 0 ||
+                             (int64_t)dot * dot * 100 < (int64_t)ORIENT_COS2_X100 * n1 * n2;
+
+        uint32_t norm = isqrt32((uint32_t)n1) * isqrt32((uint32_t)n2);
+        lastCosX100 = norm ? (int8_t)constrain(dot * 100 / (int32_t)norm, -100L, 100L) : 100;
+        lastPeakCg = (uint16_t)(isqrt32(peakMagSq) * 100UL / IMU_ACCEL_LSB_PER_G);
+        lastJerkGps = (uint16_t)min(maxJerk * IMU_SAMPLE_RATE_HZ / IMU_ACCEL_LSB_PER_G, (uint32_t)UINT16_MAX);
+
+        traceBuf[0] = TRACE_VERSION;
+        traceBuf[1] = TRACE_RATE_HZ;
+        traceBuf[2] = (uint8_t)(IMU_ACCEL_LSB_PER_G >> TRACE_SHIFT);
+        traceBuf[4] = traceSamples & 0xFF;
+        traceBuf[5] = traceSamples >> 8;
+        traceBuf[6] = lastPeakCg & 0xFF;
+        traceBuf[7] = lastPeakCg >> 8;
+        traceBuf[8] = lastJerkGps & 0xFF;
+        traceBuf[9] = lastJerkGps >> 8;
+        traceBuf[10] = (uint8_t)lastCosX100;
+        traceBuf[11] = (jerkSeen ? 0x01 : 0) | (orientChanged ? 0x02 : 0) | (truncated ? 0x04 : 0);
+
+        if (!jerkSeen)
+            rejectedJerk++;
+        else if (!orientChanged)
+            rejectedOrientation++;
+        else
+        {
+            crashes++;
+            eventPending = true;
+        }
+
+        // hướng mới làm mốc cho lần sau; 1 s trước phải gom lại từ đầu
+        gravX = ax << GRAVITY_SHIFT;
+        gravY = ay << GRAVITY_SHIFT;
+        gravZ = az << GRAVITY_SHIFT;
+        preCount = 0;
+        preHead = 0;
+
+        Serial.print(eventPending ? F("[CRASH] confirmed") : F("[CRASH] rejected"));
+        Serial.print(F(" peak(cg)="));
+        Serial.print(lastPeakCg);
+        Serial.print(F(" jerk(g/s)="));
+        Serial.print(lastJerkGps);
+        Serial.print(F(" cos(x100)="));
+        Serial.println(lastCosX100);
+    }
+
+    // Gom DECIM mẫu thô → 1 mẫu trace 50 Hz
+    void feedTrace(const ImuSample &s)
+    {
+        decSum[0] += s.ax >> TRACE_SHIFT;
+        decSum[1] += s.ay >> TRACE_SHIFT;
+        decSum[2] += s.az >> TRACE_SHIFT;
+        if (++decCount < DECIM)
+            return;
+
+        int16_t q[3];
+        for (uint8_t i = 0; i < 3; ++i)
+        {
+            q[i] = decSum[i] >> DECIM_SHIFT;
+            decSum[i] = 0;
+        }
+        decCount = 0;
+
+        if (capturing)
+        {
+            appendTrace(q[0], q[1], q[2]);
+            return;
+        }
+        if (eventPending)
+            return; // trace đang chờ gửi
+
+        for (uint8_t i = 0; i < 3; ++i)
+            preRing[preHead][i] = (int8_t)constrain(q[i], -127, 127);
+        preHead = (preHead + 1) % PRE_SAMPLES;
+        if (preCount < PRE_SAMPLES)
+            preCount++;
+    }
+
+    void appendTrace(int16_t x, int16_t y, int16_t z)
+    {
+        if (truncated)
+            return;
+
+        uint8_t tmp[9];
+        uint8_t n = 0;
+        n += putVarint(&tmp[n], zigzag(x - tracePrev[0]));
+        n += putVarint(&tmp[n], zigzag(y - tracePrev[1]));
+        n += putVarint(&tmp[n], zigzag(z - tracePrev[2]));
+
+        if (traceLen + n > CRASH_TRACE_BYTES)
+        {
+            truncated = true;
+            return;
+        }
+
+        memcpy(&traceBuf[traceLen], tmp, n);
+        traceLen += n;
+        tracePrev[0] = x;
+        tracePrev[1] = y;
+        tracePrev[2] = z;
+        traceSamples++;
+    }
+
+    static uint16_t zigzag(int16_t v) { return ((uint16_t)v << 1) ^ (uint16_t)(v >> 15); }
+
+    static uint8_t putVarint(uint8_t *out, uint16_t v)
+    {
+        uint8_t n = 0;
+        while (v >= 0x80)
+        {
+            out[n++] = (uint8_t)(v | 0x80);
+            v >>= 7;
+        }
+        out[n++] = (uint8_t)v;
+        return n;
+    }
+};
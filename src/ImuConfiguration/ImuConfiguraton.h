@@ -2,6 +2,31 @@
 #include <Wire.h>
 #include <MPU6050.h>
 #include <math.h>
+#include "ImuConfiguration/ImuSample.h"
+#include "ImuConfiguration/CrashDetector.h"
+#include "ImuConfiguration/VibrationAnalyzer.h"
+
+// -----------------------------------------------------------
+// FIFO sampling (override bằng -D trong platformio.ini)
+//   INT của MPU6050 → chân ngắt ngoài. Mega: pin 2 = INT4 (18/19 là
+//   USART1/GPS, PCINT bị SoftwareSerial của QR chiếm hết vector).
+// -----------------------------------------------------------
+#ifndef IMU_INT_PIN
+#define IMU_INT_PIN 2
+#endif
+#ifndef IMU_RING_SAMPLES
+#define IMU_RING_SAMPLES 32         // 12 B/mẫu → 384 B RAM
+#endif
+#ifndef IMU_I2C_CLOCK_HZ
+#define IMU_I2C_CLOCK_HZ 400000UL   // 12 B/mẫu @100 kHz ≈ 1.2 ms → 400 kHz
+#endif
+
+// ISR chỉ đếm xung data-ready; I2C làm trong loop()
+static volatile uint8_t imuIntPending = 0;
+
+static void imuIntIsr() {
+    if (imuIntPending < 255) imuIntPending++;
+}
 
 // -----------------------------------------------------------
 // Vehicle states (simple + practical)
@@ -14,6 +39,12 @@ enum class VehicleState : uint8_t {
     UPSIDE_DOWN     // z1 < 0.0
 };
 
+// -----------------------------------------------------------
+// z1 = round(z/|A|, 1 chữ số) tính bằng số nguyên: |round(10·r)| ≥ j
+// ⇔ |r| ≥ (2j-1)/20 ⇔ 400·z² ≥ (2j-1)²·|A|². Bảng (2j-1)², j = 1..10.
+// -----------------------------------------------------------
+static const uint16_t TILT_DECILE_EDGE_SQ[10] = {1, 9, 25, 49, 81, 121, 169, 225, 289, 361};
+
 struct ImuConfiguration {
     MPU6050 imu;
     bool initialized = false;
@@ -33,9 +64,67 @@ struct ImuConfiguration {
     float &znRounded1dp;                 // latest z_n rounded to 1 decimal (z1)
 
     // --- Internal tracking ---
-    float _lastZ1 = 999.0f;              // impossible init value
+    int8_t _lastZq = 127;                // z1 x10; impossible init value
     VehicleState _candidateState = VehicleState::UNKNOWN;
 
+    // --- Tilt: complementary filter (gyro ngắn hạn, accel dài hạn) ---
+    // Vector trọng lực ước lượng trong hệ trục xe, Q2 của raw (8192 / g)
+    static constexpr uint8_t  FUSE_Q       = 2;
+    static constexpr uint8_t  FUSE_SHIFT   = (IMU_SAMPLE_RATE_HZ == 200) ? 6 : 5; // τ ≈ 0.32 s
+    // quay 1 mẫu: rad / LSB = (π/180) / 16.4 / rate ≈ 11 / 2^20 @100 Hz
+    static constexpr uint8_t  ROT_K        = 11;
+    static constexpr uint8_t  ROT_SHIFT    = (IMU_SAMPLE_RATE_HZ == 200) ? 13 : 12; // sau >> 8
+    static constexpr int16_t  GYRO_CLAMP   = 16000;  // ~975 °/s, giữ tích trong int32
+    // bias gyro: chỉ học khi accel gần như đứng yên và tốc độ quay nhỏ
+    static constexpr uint8_t  BIAS_SHIFT   = 8;
+    static constexpr uint16_t STILL_L1     = IMU_ACCEL_LSB_PER_G * 6 / 100;   // 0.06 g
+    static constexpr int16_t  BIAS_MAX     = 30 * IMU_GYRO_LSB_PER_DPS_X10 / 10; // 30 °/s
+
+    int32_t fusedX = 0, fusedY = 0, fusedZ = 0;
+    int32_t biasX = 0, biasY = 0, biasZ = 0;   // << BIAS_SHIFT
+    int16_t _prevAx = 0, _prevAy = 0, _prevAz = 0;
+    bool fusedPrimed = false;
+
+    // --- FIFO / batch ---
+    static constexpr uint8_t  SAMPLE_BYTES  = 12;
+    static constexpr uint16_t FIFO_SIZE     = 1024;
+    static constexpr uint8_t  BURST_SAMPLES = 2;      // 24 B / transaction (Wire buffer 32 B)
+    static constexpr uint8_t  BATCH_SAMPLES = IMU_SAMPLE_RATE_HZ / 10; // ~100 ms mỗi lô
+    static constexpr unsigned long MAX_DRAIN_MS = 250UL; // dự phòng khi INT không nối
+    static constexpr uint8_t  LPF_SHIFT     = 3;      // IIR 1/8: ~2 Hz @100 Hz cho bộ phân loại
+
+    ImuSample ring[IMU_RING_SAMPLES];
+    uint8_t ringHead = 0;   // vị trí ghi
+    uint8_t ringCount = 0;
+
+    int32_t lpfAx = 0, lpfAy = 0, lpfAz = 0;  // giá trị << LPF_SHIFT
+    bool lpfPrimed = false;
+    unsigned long lastDrainMs = 0;
+
+    CrashDetector *crashDetector = nullptr;  // nhận từng mẫu thô (không lọc)
+    VibrationAnalyzer *vibration = nullptr;  // idem, chỉ gom khi INUSED
+
+    // --- Motion wake (xe đỗ): accel-only cycle mode + ngắt MOT ---
+    static constexpr uint8_t  MOT_THR_2MG     = 20;   // 40 mg (1 LSB = 2 mg)
+    static constexpr uint8_t  MOT_DUR_MS      = 5;    // mẫu liên tiếp vượt ngưỡng (1 LSB = 1 ms)
+    static constexpr uint16_t MOTION_ACCEL_L1 = IMU_ACCEL_LSB_PER_G / 10;          // 0.1 g quanh low-pass
+    static constexpr uint16_t MOTION_GYRO_L1  = 15 * IMU_GYRO_LSB_PER_DPS_X10 / 10; // 15 °/s
+
+    bool motionWake = false;
+    unsigned long lastMotionMs = 0;  // mẫu cuối có chuyển động / ngắt MOT cuối
+    uint32_t motionWakeups = 0;
+
+    // --- Stats ---
+    uint32_t samples = 0;
+    uint32_t drains = 0;
+    uint32_t fifoOverflows = 0;
+    uint16_t samplesPerSec = 0;
+    uint32_t i2cUsPerSec = 0;       // cửa sổ 1 s gần nhất
+    uint32_t i2cUsPerSecMax = 0;
+    uint32_t _i2cUsWindow = 0;
+    uint16_t _samplesWindow = 0;
+    unsigned long _statsWindowMs = 0;
+
     // --- Time requirements (tune as needed) ---
     static constexpr unsigned long UPRIGHT_HOLD_MS     = 2000UL;
     static constexpr unsigned long TILTED_HOLD_MS      = 1000UL;
@@ -66,40 +155,339 @@ struct ImuConfiguration {
         Serial.println(initialized ? "IMU ready" : "IMU connection failed");
 
         if (initialized) {
+            Wire.setClock(IMU_I2C_CLOCK_HZ);
+            configureFifo();
+
             currentState = VehicleState::UPRIGHT;
             _candidateState = VehicleState::UPRIGHT;
 
             znRounded1dp = 0.0f;
-            _lastZ1 = 1.0f;               // forces first reset
+            _lastZq = 10;                 // forces first reset
             znStableSinceMs = millis();
+            lastDrainMs = _statsWindowMs = millis();
         }
     }
 
+    // -----------------------------------------------------------
+    // FIFO: accel + gyro (12 B/mẫu) ở IMU_SAMPLE_RATE_HZ, INT phát xung
+    // 50 us mỗi mẫu (data-ready) và khi FIFO tràn
+    // -----------------------------------------------------------
+    void configureFifo() {
+        imu.setFullScaleAccelRange(MPU6050_ACCEL_FS_16);
+        imu.setFullScaleGyroRange(MPU6050_GYRO_FS_2000);
+        imu.setDLPFMode(MPU6050_DLPF_BW_42);   // gyro 1 kHz + chống alias cho 100–200 Hz
+        imu.setRate(1000 / IMU_SAMPLE_RATE_HZ - 1);
+
+        imu.setFIFOEnabled(false);
+        imu.setAccelFIFOEnabled(true);
+        imu.setXGyroFIFOEnabled(true);
+        imu.setYGyroFIFOEnabled(true);
+        imu.setZGyroFIFOEnabled(true);
+
+        imu.setInterruptMode(false);   // active-high
+        imu.setInterruptDrive(false);  // push-pull
+        imu.setInterruptLatch(false);  // xung 50 us, không cần đọc status để nhả
+        imu.setIntEnabled(_BV(MPU6050_INTERRUPT_FIFO_OFLOW_BIT) |
+                          _BV(MPU6050_INTERRUPT_DATA_RDY_BIT));
+
+        imu.resetFIFO();
+        imu.setFIFOEnabled(true);
+
+        pinMode(IMU_INT_PIN, INPUT);
+        attachInterrupt(digitalPinToInterrupt(IMU_INT_PIN), imuIntIsr, RISING);
+    }
+
+    // -----------------------------------------------------------
+    // Gọi mỗi vòng loop(). Chỉ đụng I2C khi đã có ~1 lô mẫu (đếm bằng
+    // INT) hoặc quá MAX_DRAIN_MS; rút FIFO theo burst vào ring rồi xử lý
+    // cả lô. Trả true khi có lô mới (accelX/Y/Z = giá trị đã lọc).
     // -----------------------------------------------------------
     bool update() {
         if (!initialized) return false;
 
-        imu.getMotion6(&accelX, &accelY, &accelZ,
-                       &gyroRollRate, &gyroPitchRate, &gyroYawRate);
+        unsigned long now = millis();
+        rollStats(now);
+
+        if (motionWake) {
+            // ngắt MOT: không cần I2C để biết, về lại chế độ FIFO đầy đủ
+            if (imuIntPending == 0) return false;
+            imuIntPending = 0;
+            lastMotionMs = now;
+            motionWakeups++;
+            exitMotionWake();
+            return false;
+        }
+
+        if (imuIntPending < BATCH_SAMPLES && now - lastDrainMs < MAX_DRAIN_MS)
+            return false;
+        lastDrainMs = now;
+        imuIntPending = 0;
+
+        if (drainFifo() == 0)
+            return false;
 
-        updateStateFromAccel();
+        processBatch();
         return true;
     }
 
+    // Có việc cho update() (dùng làm điều kiện thức khi MCU ngủ)
+    bool needsService() const {
+        return motionWake ? imuIntPending > 0 : imuIntPending >= BATCH_SAMPLES;
+    }
+
+    // -----------------------------------------------------------
+    // Xe đỗ yên: tắt FIFO + gyro, accel chạy cycle mode 5 Hz (~0.1 mA
+    // thay vì ~3.9 mA), INT chỉ phát khi |Δa| (sau DHPF 5 Hz) vượt
+    // MOT_THR trong MOT_DUR ms.
+    // -----------------------------------------------------------
+    void enterMotionWake() {
+        if (!initialized || motionWake) return;
+
+        imu.setFIFOEnabled(false);
+        imu.setIntEnabled(0);
+        imu.setDHPFMode(MPU6050_DHPF_5);
+        imu.setMotionDetectionThreshold(MOT_THR_2MG);
+        imu.setMotionDetectionDuration(MOT_DUR_MS);
+
+        imu.setClockSource(MPU6050_CLOCK_INTERNAL);  // PLL theo gyro X sắp tắt
+        imu.setStandbyXGyroEnabled(true);
+        imu.setStandbyYGyroEnabled(true);
+        imu.setStandbyZGyroEnabled(true);
+        imu.setTempSensorEnabled(false);
+        imu.setWakeFrequency(MPU6050_WAKE_FREQ_5);
+        imu.setWakeCycleEnabled(true);
+
+        imuIntPending = 0;
+        imu.setIntEnabled(_BV(MPU6050_INTERRUPT_MOT_BIT));
+        motionWake = true;
+        Serial.println(F("[IMU] motion-wake mode"));
+    }
+
+    void exitMotionWake() {
+        if (!motionWake) return;
+
+        imu.setIntEnabled(0);
+        imu.setWakeCycleEnabled(false);
+        imu.setStandbyXGyroEnabled(false);
+        imu.setStandbyYGyroEnabled(false);
+        imu.setStandbyZGyroEnabled(false);
+        imu.setClockSource(MPU6050_CLOCK_PLL_XGYRO);
+        imu.setDHPFMode(MPU6050_DHPF_RESET);
+
+        // gyro cần ~30 ms ổn định; low-pass / fusion mồi lại từ mẫu mới
+        ringCount = 0;
+        lpfPrimed = false;
+        fusedPrimed = false;
+        motionWake = false;
+        configureFifo();
+        lastDrainMs = millis();
+        Serial.println(F("[IMU] full sampling"));
+    }
+
+    // -----------------------------------------------------------
+    // Đọc tối đa chỗ trống của ring; phần còn lại nằm chờ trong FIFO
+    // (85 mẫu) tới vòng sau. Trả số mẫu đã đọc.
+    // -----------------------------------------------------------
+    uint8_t drainFifo() {
+        uint32_t t0 = micros();
+
+        uint8_t status = imu.getIntStatus();
+        uint16_t count = imu.getFIFOCount();
+
+        if ((status & _BV(MPU6050_INTERRUPT_FIFO_OFLOW_BIT)) || count >= FIFO_SIZE) {
+            // mẫu cũ đã bị ghi đè, biên 12 B lệch → bỏ cả FIFO
+            imu.resetFIFO();
+            fifoOverflows++;
+            _i2cUsWindow += micros() - t0;
+            return 0;
+        }
+
+        uint16_t avail = count / SAMPLE_BYTES;
+        uint8_t room = IMU_RING_SAMPLES - ringCount;
+        uint8_t n = avail < room ? (uint8_t)avail : room;
+
+        uint8_t buf[BURST_SAMPLES * SAMPLE_BYTES];
+        uint8_t done = 0;
+        while (done < n) {
+            uint8_t k = min((uint8_t)(n - done), BURST_SAMPLES);
+            imu.getFIFOBytes(buf, k * SAMPLE_BYTES);
+            for (uint8_t i = 0; i < k; ++i)
+                pushSample(&buf[i * SAMPLE_BYTES]);
+            done += k;
+        }
+
+        if (avail > n)
+            imuIntPending = BATCH_SAMPLES;  // còn mẫu → rút tiếp vòng sau
+
+        _i2cUsWindow += micros() - t0;
+        drains++;
+        return n;
+    }
+
+    void pushSample(const uint8_t *b) {
+        ImuSample &s = ring[ringHead];
+        s.ax = (int16_t)((b[0] << 8) | b[1]);
+        s.ay = (int16_t)((b[2] << 8) | b[3]);
+        s.az = (int16_t)((b[4] << 8) | b[5]);
+        s.gx = (int16_t)((b[6] << 8) | b[7]);
+        s.gy = (int16_t)((b[8] << 8) | b[9]);
+        s.gz = (int16_t)((b[10] << 8) | b[11]);
+        ringHead = (ringHead + 1) % IMU_RING_SAMPLES;
+        ringCount++;
+    }
+
+    // -----------------------------------------------------------
+    // Xử lý cả lô: mỗi mẫu → crash detector, low-pass (accelX/Y/Z cho
+    // MotionEngine) và bộ phân loại tilt (gyro + accel hợp nhất).
+    // -----------------------------------------------------------
+    void processBatch() {
+        uint8_t tail = (ringHead + IMU_RING_SAMPLES - ringCount) % IMU_RING_SAMPLES;
+        unsigned long now = millis();
+        bool moved = false;
+
+        while (ringCount) {
+            const ImuSample &s = ring[tail];
+
+            if (crashDetector) crashDetector->onSample(s);
+            if (vibration) vibration->onSample(s);
+
+            if (!lpfPrimed) {
+                lpfAx = (int32_t)s.ax << LPF_SHIFT;
+                lpfAy = (int32_t)s.ay << LPF_SHIFT;
+                lpfAz = (int32_t)s.az << LPF_SHIFT;
+                lpfPrimed = true;
+            }
+            lpfAx += s.ax - (lpfAx >> LPF_SHIFT);
+            lpfAy += s.ay - (lpfAy >> LPF_SHIFT);
+            lpfAz += s.az - (lpfAz >> LPF_SHIFT);
+
+            gyroRollRate = s.gx;
+            gyroPitchRate = s.gy;
+            gyroYawRate = s.gz;
+
+            fuseSample(s);
+            updateTilt(now);
+
+            if (!moved) {
+                uint32_t da = (uint32_t)abs((int32_t)s.ax - (lpfAx >> LPF_SHIFT)) +
+                              abs((int32_t)s.ay - (lpfAy >> LPF_SHIFT)) +
+                              abs((int32_t)s.az - (lpfAz >> LPF_SHIFT));
+                uint32_t dw = (uint32_t)abs((int32_t)s.gx - (biasX >> BIAS_SHIFT)) +
+                              abs((int32_t)s.gy - (biasY >> BIAS_SHIFT)) +
+                              abs((int32_t)s.gz - (biasZ >> BIAS_SHIFT));
+                moved = da >= MOTION_ACCEL_L1 || dw >= MOTION_GYRO_L1;
+            }
+
+            tail = (tail + 1) % IMU_RING_SAMPLES;
+            ringCount--;
+            samples++;
+            _samplesWindow++;
+        }
+
+        accelX = (int16_t)(lpfAx >> LPF_SHIFT);
+        accelY = (int16_t)(lpfAy >> LPF_SHIFT);
+        accelZ = (int16_t)(lpfAz >> LPF_SHIFT);
+
+        if (moved) lastMotionMs = now;
+    }
+
+    // -----------------------------------------------------------
+    // Complementary filter số nguyên:
+    //   g ← g + (g × ω)·dt          (xoay vector trọng lực theo gyro)
+    //   g ← g + (a − g) / 2^FUSE_SHIFT  (kéo dần về accel)
+    // Rung xóc (accel nhiễu, không quay) gần như không làm g lệch.
+    // -----------------------------------------------------------
+    void fuseSample(const ImuSample &s) {
+        if (!fusedPrimed) {
+            fusedX = (int32_t)s.ax << FUSE_Q;
+            fusedY = (int32_t)s.ay << FUSE_Q;
+            fusedZ = (int32_t)s.az << FUSE_Q;
+            _prevAx = s.ax; _prevAy = s.ay; _prevAz = s.az;
+            fusedPrimed = true;
+        }
+
+        uint16_t still = (uint16_t)min((int32_t)abs((int32_t)s.ax - _prevAx) +
+                                       abs((int32_t)s.ay - _prevAy) +
+                                       abs((int32_t)s.az - _prevAz), (int32_t)UINT16_MAX);
+        _prevAx = s.ax; _prevAy = s.ay; _prevAz = s.az;
+
+        if (still < STILL_L1 && abs(s.gx) < BIAS_MAX && abs(s.gy) < BIAS_MAX && abs(s.gz) < BIAS_MAX) {
+            biasX += s.gx - (biasX >> BIAS_SHIFT);
+            biasY += s.gy - (biasY >> BIAS_SHIFT);
+            biasZ += s.gz - (biasZ >> BIAS_SHIFT);
+        }
+
+        int16_t wx = (int16_t)constrain((int32_t)s.gx - (biasX >> BIAS_SHIFT), -GYRO_CLAMP, GYRO_CLAMP);
+        int16_t wy = (int16_t)constrain((int32_t)s.gy - (biasY >> BIAS_SHIFT), -GYRO_CLAMP, GYRO_CLAMP);
+        int16_t wz = (int16_t)constrain((int32_t)s.gz - (biasZ >> BIAS_SHIFT), -GYRO_CLAMP, GYRO_CLAMP);
+
+        // ±4 g trong Q2 vẫn vừa int16 → tích 16x16 bit
+        int16_t gx = (int16_t)constrain(fusedX, -32767L, 32767L);
+        int16_t gy = (int16_t)constrain(fusedY, -32767L, 32767L);
+        int16_t gz = (int16_t)constrain(fusedZ, -32767L, 32767L);
+
+        fusedX += rotate((int32_t)gy * wz - (int32_t)gz * wy);
+        fusedY += rotate((int32_t)gz * wx - (int32_t)gx * wz);
+        fusedZ += rotate((int32_t)gx * wy - (int32_t)gy * wx);
+
+        fusedX += (((int32_t)s.ax << FUSE_Q) - fusedX) >> FUSE_SHIFT;
+        fusedY += (((int32_t)s.ay << FUSE_Q) - fusedY) >> FUSE_SHIFT;
+        fusedZ += (((int32_t)s.az << FUSE_Q) - fusedZ) >> FUSE_SHIFT;
+    }
+
+    static int32_t rotate(int32_t crossQ) {
+        return ((crossQ >> 8) * ROT_K) >> ROT_SHIFT;
+    }
+
+    // round(10 · z/|g|) trên vector đã hợp nhất, không sqrt / chia:
+    // tìm nhị phân trong TILT_DECILE_EDGE_SQ (4 phép so)
+    int8_t tiltDecile() const {
+        // 512 LSB/g: 400·z² và 361·|g|² vẫn trong uint32 tới ~3 g
+        int32_t x = constrain(fusedX >> (FUSE_Q + 2), -1500L, 1500L);
+        int32_t y = constrain(fusedY >> (FUSE_Q + 2), -1500L, 1500L);
+        int32_t z = constrain(fusedZ >> (FUSE_Q + 2), -1500L, 1500L);
+
+        uint32_t n2 = (uint32_t)(x * x + y * y + z * z);
+        if (n2 == 0) return 0;
+        uint32_t z400 = (uint32_t)(z * z) * 400UL;
+
+        uint8_t lo = 0, hi = 10;   // số ngưỡng đã vượt ∈ [lo, hi]
+        while (lo < hi) {
+            uint8_t mid = (lo + hi + 1) >> 1;
+            if (z400 >= TILT_DECILE_EDGE_SQ[mid - 1] * n2) lo = mid;
+            else hi = mid - 1;
+        }
+        return z < 0 ? -(int8_t)lo : (int8_t)lo;
+    }
+
+    // I2C us và số mẫu mỗi giây (chuẩn hoá khi loop() bị kẹt lâu hơn 1 s)
+    void rollStats(unsigned long now) {
+        unsigned long elapsed = now - _statsWindowMs;
+        if (elapsed < 1000UL) return;
+
+        i2cUsPerSec = _i2cUsWindow * 1000UL / elapsed;
+        if (i2cUsPerSec > i2cUsPerSecMax) i2cUsPerSecMax = i2cUsPerSec;
+        samplesPerSec = (uint16_t)((uint32_t)_samplesWindow * 1000UL / elapsed);
+
+        _i2cUsWindow = 0;
+        _samplesWindow = 0;
+        _statsWindowMs = now;
+    }
+
     // -----------------------------------------------------------
     static float round1dp(float v) {
         return roundf(v * 10.0f) / 10.0f;
     }
 
-    // Classification rule you specified:
+    // Classification rule you specified (zq = z1 x10):
     //  - 0.8..1.0 : UPRIGHT
     //  - 0.7..0.8 : TILTED
     //  - 0.0..0.7 : ON_SIDE
     //  - < 0.0    : UPSIDE_DOWN
-    static VehicleState classifyByZ1(float z1) {
-        if (z1 >= 0.8f) return VehicleState::UPRIGHT;
-        if (z1 >= 0.7f) return VehicleState::TILTED;
-        if (z1 >= 0.0f) return VehicleState::ON_SIDE;
+    static VehicleState classifyByZq(int8_t zq) {
+        if (zq >= 8) return VehicleState::UPRIGHT;
+        if (zq >= 7) return VehicleState::TILTED;
+        if (zq >= 0) return VehicleState::ON_SIDE;
         return VehicleState::UPSIDE_DOWN;
     }
 
@@ -114,30 +502,18 @@ struct ImuConfiguration {
     }
 
     // -----------------------------------------------------------
-    void updateStateFromAccel() {
-        // Compute magnitude A
-        float A = sqrtf(
-            (float)accelX * accelX +
-            (float)accelY * accelY +
-            (float)accelZ * accelZ
-        );
-        if (A <= 0.0001f) return;
-
-        // Compute normalized z and round to 1 decimal
-        float z_n = accelZ / A;
-        float z1 = round1dp(z_n);
-        znRounded1dp = z1;
-
-        unsigned long now = millis();
+    void updateTilt(unsigned long now) {
+        int8_t zq = tiltDecile();
 
         // Reset timer whenever rounded z1 changes
-        if (z1 != _lastZ1) {
-            _lastZ1 = z1;
+        if (zq != _lastZq) {
+            _lastZq = zq;
+            znRounded1dp = zq * 0.1f;
             znStableSinceMs = now;
         }
 
         // Candidate state is based on current z1
-        VehicleState candidate = classifyByZ1(z1);
+        VehicleState candidate = classifyByZq(zq);
 
         // If candidate state changed, restart timing (must be stable in the new state)
         if (candidate != _candidateState) {
@@ -183,7 +559,7 @@ struct ImuConfiguration {
             z_n = accelZ / A;
         }
 
-        float z1 = round1dp(z_n); // shown value (1 decimal)
+        float z1 = znRounded1dp; // z1 của bộ phân loại (gyro + accel hợp nhất)
 
         Serial.print("Accel (X,Y,Z): ");
         Serial.print(accelX); Serial.print(", ");
@@ -208,4 +584,24 @@ struct ImuConfiguration {
 
         Serial.println();
     }
+
+    // -----------------------------------------------------------
+    void printStats() {
+        Serial.print(F("[IMU] rate(Hz)="));
+        Serial.print(samplesPerSec);
+        Serial.print(F(" samples="));
+        Serial.print(samples);
+        Serial.print(F(" drains="));
+        Serial.print(drains);
+        Serial.print(F(" fifoOverflows="));
+        Serial.print(fifoOverflows);
+        Serial.print(F(" motionWakeups="));
+        Serial.print(motionWakeups);
+        Serial.print(F(" i2c(us/s)="));
+        Serial.print(i2cUsPerSec);
+        Serial.print(F(" max="));
+        Serial.print(i2cUsPerSecMax);
+        Serial.print(F(" state="));
+        Serial.println(stateToString(currentState));
+    }
 };
\ No newline at end of file
@@ -0,0 +1,23 @@
+#pragma once
+#include <Arduino.h>
+
+// -----------------------------------------------------------
+// Mẫu IMU thô từ FIFO, dùng chung cho ImuConfiguration và các bộ
+// xử lý theo từng mẫu (CrashDetector...)
+// -----------------------------------------------------------
+#ifndef IMU_SAMPLE_RATE_HZ
+#define IMU_SAMPLE_RATE_HZ 100      // 100 hoặc 200; = 1 kHz / (1 + SMPLRT_DIV) khi bật DLPF
+#endif
+
+static_assert(IMU_SAMPLE_RATE_HZ == 100 || IMU_SAMPLE_RATE_HZ == 200,
+              "IMU_SAMPLE_RATE_HZ must be 100 or 200");
+
+// Dải đo: ±16 g / ±2000 dps để va chạm không bão hoà cảm biến
+static const uint16_t IMU_ACCEL_LSB_PER_G       = 2048;
+static const uint16_t IMU_GYRO_LSB_PER_DPS_X10  = 164;   // 16.4 LSB/(°/s)
+
+// Một mẫu FIFO: accel X/Y/Z rồi gyro X/Y/Z (thứ tự thanh ghi 0x3B..0x48)
+struct ImuSample {
+    int16_t ax, ay, az;
+    int16_t gx, gy, gz;
+};
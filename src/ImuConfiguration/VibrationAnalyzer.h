@@ -0,0 +1,241 @@
+#pragma once
+#include <Arduino.h>
+#include "ImuConfiguration/ImuSample.h"
+#include "MotionConfiguration/MotionEngine.h"   // isqrt32
+#include "Domains/Telemetry.h"
+
+// -----------------------------------------------------------
+// FFT số nguyên 128 điểm (radix-2 DIT, Q15, in-place)
+//
+// Mỗi tầng chia 2 (block scaling cố định) → không tràn int16, kết quả
+// = DFT / N. Twiddle lấy từ bảng 1/4 chu kỳ sin (33 giá trị PROGMEM).
+// -----------------------------------------------------------
+static const uint8_t FFT_N = 128;
+
+static const int16_t FFT_QUARTER_SIN_Q15[33] PROGMEM = {
+    0, 1608, 3212, 4808, 6393, 7962, 9512, 11039, 12539, 14010, 15446,
+    16846, 18204, 19519, 20787, 22005, 23170, 24279, 25329, 26319, 27245,
+    28105, 28898, 29621, 30273, 30852, 31356, 31785, 32137, 32412, 32609,
+    32728, 32767};
+
+// sin(2π·m/128), Q15
+static inline int16_t fftSinQ15(uint8_t m)
+{
+    m &= FFT_N - 1;
+    bool neg = m >= FFT_N / 2;
+    m &= FFT_N / 2 - 1;
+    if (m > FFT_N / 4)
+        m = FFT_N / 2 - m;
+    int16_t v = (int16_t)pgm_read_word(&FFT_QUARTER_SIN_Q15[m]);
+    return neg ? -v : v;
+}
+
+static inline int16_t fftCosQ15(uint8_t m)
+{
+    return fftSinQ15(m + FFT_N / 4);
+}
+
+static void fft128Q15(int16_t *re, int16_t *im)
+{
+    // hoán vị bit-reversal
+    for (uint8_t i = 1, j = 0; i < FFT_N; ++i)
+    {
+        uint8_t bit = FFT_N >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+        {
+            int16_t t = re[i]; re[i] = re[j]; re[j] = t;
+            t = im[i]; im[i] = im[j]; im[j] = t;
+        }
+    }
+
+    for (uint16_t len = 2; len <= FFT_N; len <<= 1)
+    {
+        uint8_t half = len >> 1;
+        uint8_t step = FFT_N / len;
+        for (uint8_t k = 0; k < half; ++k)
+        {
+            // W = cos − j·sin
+            int16_t wr = fftCosQ15(k * step);
+            int16_t wi = -fftSinQ15(k * step);
+            for (uint8_t i = k; i < FFT_N; i += len)
+            {
+                uint8_t j = i + half;
+                int16_t tr = (int16_t)(((int32_t)re[j] * wr - (int32_t)im[j] * wi) >> 15);
+                int16_t ti = (int16_t)(((int32_t)re[j] * wi + (int32_t)im[j] * wr) >> 15);
+                int16_t ur = re[i], ui = im[i];
+                re[j] = (int16_t)(((int32_t)ur - tr) >> 1);
+                im[j] = (int16_t)(((int32_t)ui - ti) >> 1);
+                re[i] = (int16_t)(((int32_t)ur + tr) >> 1);
+                im[i] = (int16_t)(((int32_t)ui + ti) >> 1);
+            }
+        }
+    }
+}
+
+/**
+ * VibrationAnalyzer
+ *
+ * Phổ rung trục Z (thẳng đứng khi xe chạy) trong lúc INUSED, không gửi
+ * mẫu thô qua mạng:
+ *   - cửa sổ 128 mẫu (1.28 s @100 Hz), bỏ DC bằng IIR, Hann, FFT Q15
+ *   - 8 dải x 8 bin (6.25 Hz / dải @100 Hz; 12.5 Hz @200 Hz), dải 0 bỏ
+ *     bin DC → năng lượng dải: bánh / bạc đạn / mặt đường
+ *   - roughness = RMS gia tốc đứng (mg) từ bin 1..63 (Parseval, bù Hann)
+ * takeSummary() trả trung bình các cửa sổ từ lần lấy trước, dải mã hoá
+ * 1/4 octave (xem VibrationSummary trong Telemetry.h).
+ */
+class VibrationAnalyzer
+{
+public:
+    static const uint8_t BANDS         = VIBRATION_BANDS;
+    static const uint8_t BINS_PER_BAND = FFT_N / 2 / BANDS;
+    static const uint8_t INPUT_SHIFT   = 2;   // 2048 → 8192 LSB/g, dùng dải int16
+    static const uint8_t DC_SHIFT      = 6;
+    static const uint8_t ACC_SHIFT     = 4;   // năng lượng / cửa sổ trước khi cộng dồn
+
+    // ---------------- Stats ----------------
+    uint32_t windows = 0;
+    uint32_t lastWindowUs = 0;
+    uint32_t maxWindowUs = 0;
+
+    void setEnabled(bool on)
+    {
+        if (on == enabled)
+            return;
+        enabled = on;
+        fill = 0;
+        dcPrimed = false;
+        if (on)
+        {
+            // chuyến mới: bỏ phần gộp của chuyến trước
+            memset(bandAcc, 0, sizeof(bandAcc));
+            roughAcc = 0;
+            windowsAcc = 0;
+        }
+    }
+
+    void onSample(const ImuSample &s)
+    {
+        if (!enabled)
+            return;
+
+        int32_t x = (int32_t)s.az << INPUT_SHIFT;
+        if (!dcPrimed)
+        {
+            dc = x << DC_SHIFT;
+            dcPrimed = true;
+        }
+        dc += x - (dc >> DC_SHIFT);
+
+        re[fill] = (int16_t)constrain(x - (dc >> DC_SHIFT), -32767L, 32767L);
+        if (++fill == FFT_N)
+        {
+            fill = 0;
+            uint32_t t0 = micros();
+            analyzeWindow();
+            lastWindowUs = micros() - t0;
+            if (lastWindowUs > maxWindowUs)
+                maxWindowUs = lastWindowUs;
+        }
+    }
+
+    // Hann + FFT + năng lượng dải trên re[] đủ 128 mẫu (im[] bị ghi đè)
+    void analyzeWindow()
+    {
+        for (uint8_t n = 0; n < FFT_N; ++n)
+        {
+            int32_t w = (32767L - fftCosQ15(n)) >> 1;   // Hann tuần hoàn, Q15
+            re[n] = (int16_t)(((int32_t)re[n] * w) >> 15);
+            im[n] = 0;
+        }
+
+        fft128Q15(re, im);
+
+        uint32_t total = 0;
+        for (uint8_t b = 0; b < BANDS; ++b)
+        {
+            uint32_t e = 0;
+            for (uint8_t k = b * BINS_PER_BAND; k < (b + 1) * BINS_PER_BAND; ++k)
+            {
+                if (k == 0)
+                    continue; // DC
+                e = satAdd(e, (uint32_t)((int32_t)re[k] * re[k]) + (uint32_t)((int32_t)im[k] * im[k]));
+            }
+            bandAcc[b] = satAdd(bandAcc[b], e >> ACC_SHIFT);
+            total = satAdd(total, e);
+        }
+
+        // RMS² = 2 · Σ|X/N|² / mean(w²) = (16/3) · Σ; 8192 LSB/g → mg
+        uint32_t rmsUnits = isqrt32(total / 3) * 4;
+        roughAcc = satAdd(roughAcc, rmsUnits * 125UL / 1024UL);
+
+        windowsAcc++;
+        windows++;
+    }
+
+    // Trung bình từ lần lấy trước; false nếu chưa có cửa sổ nào
+    bool takeSummary(VibrationSummary &out)
+    {
+        if (windowsAcc == 0)
+            return false;
+
+        out.windows = (uint8_t)min(windowsAcc, (uint16_t)255);
+        out.roughness_mg = (uint16_t)min(roughAcc / windowsAcc, (uint32_t)UINT16_MAX);
+        for (uint8_t b = 0; b < BANDS; ++b)
+        {
+            out.bands[b] = quarterLog2(bandAcc[b] / windowsAcc);
+            bandAcc[b] = 0;
+        }
+        lastRoughnessMg = out.roughness_mg;
+
+        roughAcc = 0;
+        windowsAcc = 0;
+        return true;
+    }
+
+    void printStats()
+    {
+        Serial.print(F("[VIB] windows="));
+        Serial.print(windows);
+        Serial.print(F(" roughness(mg)="));
+        Serial.print(lastRoughnessMg);
+        Serial.print(F(" us/window="));
+        Serial.print(lastWindowUs);
+        Serial.print(F(" max="));
+        Serial.println(maxWindowUs);
+    }
+
+    // 0 = không có năng lượng, còn lại v = 4·log2(E) + 1 (bước 1/4 octave)
+    static uint8_t quarterLog2(uint32_t e)
+    {
+        if (e == 0)
+            return 0;
+        uint8_t msb = 31;
+        while (!(e & (1UL << msb)))
+            msb--;
+        uint8_t frac = msb >= 2 ? (uint8_t)((e >> (msb - 2)) & 3) : (uint8_t)((e << (2 - msb)) & 3);
+        return (uint8_t)(4 * msb + frac + 1);
+    }
+
+private:
+    bool enabled = false;
+    bool dcPrimed = false;
+    int32_t dc = 0;
+    uint8_t fill = 0;
+    int16_t re[FFT_N];
+    int16_t im[FFT_N];
+
+    uint32_t bandAcc[VIBRATION_BANDS] = {0};
+    uint32_t roughAcc = 0;
+    uint16_t windowsAcc = 0;
+    uint16_t lastRoughnessMg = 0;
+
+    static uint32_t satAdd(uint32_t a, uint32_t b)
+    {
+        uint32_t s = a + b;
+        return s < a ? UINT32_MAX : s;
+    }
+};
@@ -0,0 +1,351 @@
+#pragma once
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "StorageConfiguration/EepromLayout.h"
+#include "StorageConfiguration/EepromJournal.h"
+
+// -----------------------------------------------------------
+// Fixed-point helpers
+// -----------------------------------------------------------
+
+// 1e-7 độ trên vòng tròn lớn (R = 6371 km, cùng bán kính với
+// GpsConfiguration::distanceBetween) ≈ 11.1195 mm = 22239 / 2000
+static const uint32_t E7_TO_MM_X2000 = 22239UL;
+
+// sqrt nguyên, làm tròn tới số gần nhất (không lệch hệ thống khi cộng dồn)
+static inline uint32_t isqrt32(uint32_t v)
+{
+    uint32_t res = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > v)
+        bit >>= 2;
+    while (bit)
+    {
+        if (v >= res + bit)
+        {
+            v -= res + bit;
+            res = (res >> 1) + bit;
+        }
+        else
+        {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    if (v > res)
+        res++;
+    return res;
+}
+
+/**
+ * Khoảng cách equirectangular (mm) giữa 2 điểm toạ độ nguyên (deg * 1e-7).
+ *
+ *   y = dLat,  x = dLon * cos(lat)   (cos cho sẵn dạng Q15)
+ *   d = sqrt(x² + y²) * 11.1195 mm
+ *
+ * Chỉ nhân/dịch số nguyên + 1 isqrt, không sin/cos/atan2 như
+ * GpsConfiguration::distanceBetween. Sai số so với Haversine < 0.1% cho
+ * bước vài trăm mét (bước GPS chỉ vài mét). Bước > 0.003° (~330 m)
+ * trả UINT32_MAX để caller coi là glitch (tránh tràn 32-bit).
+ */
+static inline uint32_t equirectDistanceMm(int32_t latE7a, int32_t lonE7a,
+                                          int32_t latE7b, int32_t lonE7b,
+                                          uint16_t cosLatQ15)
+{
+    int32_t dLat = latE7b - latE7a;
+    int32_t dLon = lonE7b - lonE7a;
+    if (dLat < 0) dLat = -dLat;
+    if (dLon < 0) dLon = -dLon;
+
+    if (dLat > 30000L || dLon > 30000L)
+        return UINT32_MAX;
+
+    uint32_t y = (uint32_t)dLat;
+    uint32_t x = ((uint32_t)dLon * cosLatQ15 + 16384UL) >> 15;
+
+    uint32_t dE7 = isqrt32(x * x + y * y);
+    return (dE7 * E7_TO_MM_X2000 + 1000UL) / 2000UL;
+}
+
+/**
+ * MotionEngine
+ *
+ * - Tốc độ: GPS ground speed (UBX gSpeed / NMEA speed) nếu có, không thì
+ *   lấy từ quãng đường giữa 2 fix / dt. Giữa 2 fix GPS, gia tốc dọc
+ *   trục xe từ IMU (đã trừ bias chậm) được tích phân để tốc độ không
+ *   bị bậc thang; mỗi fix GPS kéo ước lượng về lại (complementary).
+ * - Odometer: cộng khoảng cách equirectangular fixed-point giữa các
+ *   fix khi xe thực sự chạy (bỏ jitter khi đứng yên + điểm nhảy).
+ * - Odometer trọn đời lưu EEPROM, xoay vòng ODO_SLOTS slot để giảm mòn.
+ */
+struct MotionEngine
+{
+    // ---------------- Tuning ----------------
+    static const int32_t  MOVING_MIN_MM_S   = 280;    // ~1 km/h: dưới mức này coi như đứng yên
+    static const uint32_t MAX_STEP_MM_S     = 50000;  // > 50 m/s giữa 2 fix → glitch
+    static const uint32_t FIX_GAP_RESET_MS  = 5000;   // mất fix lâu → bắt đầu đoạn mới
+    static const uint32_t SAVE_EVERY_M      = 500;
+    static const uint8_t  ODO_SLOTS         = 4;
+    static const uint16_t ODO_MAGIC         = 0x0D0B;
+
+    float &speedKmhOut; // currentSpeedKmh (DisplayTask)
+
+    // ---------------- Speed state ----------------
+    int32_t speedMmS     = 0;
+    int32_t gpsSpeedMmS  = -1;
+    uint32_t lastImuMs   = 0;
+    int32_t accelBiasQ8  = 0;   // bias trục X (raw LSB * 256), low-pass rất chậm
+
+    // ---------------- Position state ----------------
+    bool     hasLast     = false;
+    int32_t  lastLatE7   = 0;
+    int32_t  lastLonE7   = 0;
+    uint32_t lastFixMs   = 0;
+    int32_t  cosLatRefE7 = 0x7FFFFFFF;
+    uint16_t cosLatQ15   = 32768;
+
+    // ---------------- Odometer ----------------
+    uint32_t tripMm          = 0;
+    uint32_t lifetimeM       = 0;  // mét trọn đời (đã + chưa lưu)
+    uint32_t lifetimeRemMm   = 0;  // phần lẻ < 1 m
+    uint32_t lastSavedM      = 0;
+    uint16_t saveSeq         = 0;
+    uint8_t  nextSlot        = 0;
+
+    // ---------------- Stats ----------------
+    uint32_t fixesUsed     = 0;
+    uint32_t glitchesSkip  = 0;
+    uint32_t distUs        = 0;   // tổng µs trong equirectDistanceMm
+    uint32_t distCalls     = 0;
+
+    explicit MotionEngine(float &speedKmhRef)
+        : speedKmhOut(speedKmhRef) {}
+
+    void begin()
+    {
+        loadOdometer();
+        Serial.print(F("[ODO] lifetime(m)="));
+        Serial.println(lifetimeM);
+    }
+
+    // -------------------------------------------------
+    // GPS fix mới (toạ độ nguyên). groundSpeedMmS < 0 = không có
+    // -------------------------------------------------
+    void onGpsFix(int32_t latE7, int32_t lonE7, int32_t groundSpeedMmS)
+    {
+        uint32_t nowMs = millis();
+        fixesUsed++;
+
+        updateCosLat(latE7);
+
+        if (!hasLast || nowMs - lastFixMs > FIX_GAP_RESET_MS)
+        {
+            setLast(latE7, lonE7, nowMs);
+            gpsSpeedMmS = groundSpeedMmS;
+            applyGpsSpeed(groundSpeedMmS < 0 ? 0 : groundSpeedMmS);
+            return;
+        }
+
+        uint32_t t0 = micros();
+        uint32_t stepMm = equirectDistanceMm(lastLatE7, lastLonE7, latE7, lonE7, cosLatQ15);
+        distUs += micros() - t0;
+        distCalls++;
+
+        uint32_t dtMs = nowMs - lastFixMs;
+        if (dtMs == 0)
+            return;
+
+        if (stepMm == UINT32_MAX || stepMm > MAX_STEP_MM_S / 1000UL * (dtMs + 1000UL))
+        {
+            // điểm nhảy: bỏ, giữ mốc cũ
+            glitchesSkip++;
+            return;
+        }
+
+        // tốc độ: ưu tiên Doppler của GPS, không có thì lấy từ vị trí
+        int32_t v = groundSpeedMmS;
+        if (v < 0)
+            v = (int32_t)(stepMm * 1000UL / dtMs);
+        gpsSpeedMmS = v;
+        applyGpsSpeed(v);
+
+        // Chỉ cộng quãng đường khi xe chạy thật (jitter khi đứng yên ~ vài m)
+        if (v >= MOVING_MIN_MM_S)
+            addDistance(stepMm);
+
+        setLast(latE7, lonE7, nowMs);
+    }
+
+    // -------------------------------------------------
+    // Mẫu IMU: gia tốc trục dọc xe (raw), lsbPerG theo range cấu hình
+    // -------------------------------------------------
+    void onAccel(int16_t axRaw, uint16_t lsbPerG)
+    {
+        uint32_t nowMs = millis();
+        uint32_t dtMs = nowMs - lastImuMs;
+        lastImuMs = nowMs;
+
+        // bias (trọng lực do xe nghiêng dốc, offset cảm biến): low-pass ~1/256
+        int32_t sampleQ8 = (int32_t)axRaw << 8;
+        accelBiasQ8 += (sampleQ8 - accelBiasQ8) >> 8;
+
+        if (dtMs == 0 || dtMs > 200 || speedMmS == 0)
+            return; // mẫu quá thưa / xe đứng yên → không tích phân
+
+        // a (mm/s²) = (ax - bias) / lsbPerG * 9807
+        int32_t aRaw = axRaw - (int32_t)(accelBiasQ8 >> 8);
+        int32_t aMmS2 = (int32_t)((int32_t)aRaw * 9807L / (int32_t)lsbPerG);
+
+        speedMmS += (int32_t)(aMmS2 * (int32_t)dtMs / 1000);
+        if (speedMmS < 0)
+            speedMmS = 0;
+        publishSpeed();
+    }
+
+    // -------------------------------------------------
+    // Trip
+    // -------------------------------------------------
+    void startTrip()
+    {
+        tripMm = 0;
+        Serial.println(F("[ODO] trip start"));
+    }
+
+    void endTrip()
+    {
+        Serial.print(F("[ODO] trip end, m="));
+        Serial.println(tripMeters());
+        saveOdometer();
+    }
+
+    uint32_t tripMeters() const { return tripMm / 1000; }
+    uint32_t lifetimeMeters() const { return lifetimeM; }
+    int32_t  speedMmPerS() const { return speedMmS; }
+
+    void printStats()
+    {
+        Serial.print(F("[ODO] speed(mm/s)="));
+        Serial.print(speedMmS);
+        Serial.print(F(" trip(m)="));
+        Serial.print(tripMeters());
+        Serial.print(F(" lifetime(m)="));
+        Serial.print(lifetimeM);
+        Serial.print(F(" fixes="));
+        Serial.print(fixesUsed);
+        Serial.print(F(" glitches="));
+        Serial.print(glitchesSkip);
+        Serial.print(F(" us/dist="));
+        Serial.println(distCalls ? distUs / distCalls : 0);
+    }
+
+private:
+    void setLast(int32_t latE7, int32_t lonE7, uint32_t nowMs)
+    {
+        hasLast = true;
+        lastLatE7 = latE7;
+        lastLonE7 = lonE7;
+        lastFixMs = nowMs;
+    }
+
+    // cos(lat) chỉ tính lại khi vĩ độ đổi > ~0.05° (vài km) → gần như 1 lần
+    void updateCosLat(int32_t latE7)
+    {
+        int32_t d = latE7 - cosLatRefE7;
+        if (d < 0) d = -d;
+        if (cosLatRefE7 != 0x7FFFFFFF && d < 500000L)
+            return;
+
+        cosLatRefE7 = latE7;
+        float c = cos(radians(latE7 * 1e-7f));
+        cosLatQ15 = (uint16_t)(c * 32768.0f);
+    }
+
+    void applyGpsSpeed(int32_t gpsMmS)
+    {
+        // complementary: 3/4 GPS + 1/4 ước lượng IMU
+        speedMmS = (gpsMmS * 3 + speedMmS) / 4;
+        if (gpsMmS < MOVING_MIN_MM_S && speedMmS < MOVING_MIN_MM_S)
+            speedMmS = 0;
+        publishSpeed();
+    }
+
+    void publishSpeed()
+    {
+        // mm/s → km/h
+        speedKmhOut = speedMmS * 0.0036f;
+    }
+
+    void addDistance(uint32_t stepMm)
+    {
+        tripMm += stepMm;
+        lifetimeRemMm += stepMm;
+        if (lifetimeRemMm >= 1000)
+        {
+            lifetimeM += lifetimeRemMm / 1000;
+            lifetimeRemMm %= 1000;
+        }
+
+        if (lifetimeM - lastSavedM >= SAVE_EVERY_M)
+            saveOdometer();
+    }
+
+    // ===================================================
+    //  EEPROM: ODO_SLOTS slot {magic, seq, meters}, slot có seq mới nhất thắng
+    // ===================================================
+    struct OdoSlot
+    {
+        uint16_t magic;
+        uint16_t seq;
+        uint32_t meters;
+    };
+
+    static int slotAddr(uint8_t i)
+    {
+        return EEPROM_ODOMETER_ADDR + i * (int)sizeof(OdoSlot);
+    }
+
+    void loadOdometer()
+    {
+        EepromLock lock;
+        bool found = false;
+        for (uint8_t i = 0; i < ODO_SLOTS; ++i)
+        {
+            OdoSlot s;
+            EEPROM.get(slotAddr(i), s);
+            if (s.magic != ODO_MAGIC)
+                continue;
+
+            // so sánh seq kiểu wrap-around
+            if (!found || (int16_t)(s.seq - saveSeq) > 0)
+            {
+                found = true;
+                saveSeq = s.seq;
+                lifetimeM = s.meters;
+                nextSlot = (i + 1) % ODO_SLOTS;
+            }
+        }
+
+        if (!found)
+        {
+            lifetimeM = 0;
+            saveSeq = 0;
+            nextSlot = 0;
+        }
+        lastSavedM = lifetimeM;
+    }
+
+    void saveOdometer()
+    {
+        if (lifetimeM == lastSavedM)
+            return;
+
+        EepromLock lock;
+        OdoSlot s;
+        s.magic = ODO_MAGIC;
+        s.seq = ++saveSeq;
+        s.meters = lifetimeM;
+        EEPROM.put(slotAddr(nextSlot), s);
+        nextSlot = (nextSlot + 1) % ODO_SLOTS;
+        lastSavedM = lifetimeM;
+    }
+};
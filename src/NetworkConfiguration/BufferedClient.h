@@ -0,0 +1,109 @@
+#pragma once
+#include <Arduino.h>
+#include <Client.h>
+
+#ifndef BUFFERED_CLIENT_SIZE
+#define BUFFERED_CLIENT_SIZE 256
+#endif
+
+/**
+ * BufferedClient
+ *
+ * Mỗi lần gọi TinyGsmClient::write() là một lần AT+CIPSEND với modem
+ * (vài chục → vài trăm ms trên mạng di động). Wrapper này gom các
+ * print()/write() vào buffer cố định và chỉ gửi xuống modem khi:
+ *   - gọi flush() / sendBuffered() tường minh, hoặc
+ *   - buffer đầy.
+ *
+ *   BufferedClient out(gsm.httpClient);
+ *   out.print("GET / HTTP/1.1\r\n");
+ *   out.print("Host: example.com\r\n\r\n");
+ *   out.flush();   // 1 lần CIPSEND
+ */
+struct BufferedClient : public Print
+{
+    Client &client;
+
+    uint8_t buffer[BUFFERED_CLIENT_SIZE];
+    size_t  used = 0;
+    bool    writeError = false;
+
+    // ---------------- Stats ----------------
+    uint32_t writeCalls = 0; // số lần print/write từ phía producer
+    uint32_t modemSends = 0; // số lần thật sự ghi xuống modem
+    uint32_t sendUs     = 0; // tổng thời gian ghi xuống modem (µs)
+
+    explicit BufferedClient(Client &c)
+        : client(c) {}
+
+    size_t write(uint8_t b) override
+    {
+        return write(&b, 1);
+    }
+
+    size_t write(const uint8_t *data, size_t len) override
+    {
+        if (!data || len == 0)
+            return 0;
+
+        writeCalls++;
+
+        size_t written = 0;
+        while (written < len)
+        {
+            if (used == BUFFERED_CLIENT_SIZE && !sendBuffered())
+                return written;
+
+            size_t room = BUFFERED_CLIENT_SIZE - used;
+            size_t n = len - written;
+            if (n > room)
+                n = room;
+
+            memcpy(buffer + used, data + written, n);
+            used += n;
+            written += n;
+        }
+        return written;
+    }
+
+    // Print::flush() (void) → gửi phần còn lại trong buffer
+    void flush() override
+    {
+        sendBuffered();
+    }
+
+    // Gửi toàn bộ buffer trong một lần ghi xuống modem
+    bool sendBuffered()
+    {
+        if (used == 0)
+            return !writeError;
+
+        uint32_t t0 = micros();
+        size_t sent = client.write(buffer, used);
+        sendUs += micros() - t0;
+        modemSends++;
+
+        bool ok = (sent == used);
+        if (!ok)
+            writeError = true;
+
+        used = 0;
+        return ok;
+    }
+
+    // Bỏ dữ liệu chưa gửi + reset cờ lỗi (trước một request mới)
+    void reset()
+    {
+        used = 0;
+        writeError = false;
+    }
+
+    bool hasError() const { return writeError; }
+
+    void resetStats()
+    {
+        writeCalls = 0;
+        modemSends = 0;
+        sendUs = 0;
+    }
+};
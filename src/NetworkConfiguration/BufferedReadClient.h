@@ -0,0 +1,152 @@
+#pragma once
+#include <Arduino.h>
+#include <Client.h>
+
+#ifndef BUFFERED_READ_CLIENT_SIZE
+#define BUFFERED_READ_CLIENT_SIZE 64
+#endif
+
+/**
+ * BufferedReadClient
+ *
+ * PubSubClient đọc từng byte (_client->read()), mỗi lần read() của
+ * TinyGsmClient lại gọi modem.maintain() (quét URC, có thể kèm
+ * AT+CIPRXGET). Wrapper này đọc khối bằng read(buf, len) vào buffer
+ * nhỏ rồi trả từng byte từ RAM → số lần chạm modem giảm theo khối.
+ *
+ * Ghi (write) đi thẳng xuống client bên dưới.
+ */
+struct BufferedReadClient : public Client
+{
+    Client &client;
+
+    uint8_t rxBuf[BUFFERED_READ_CLIENT_SIZE];
+    uint8_t rxHead = 0;
+    uint8_t rxLen  = 0;
+
+    // ---------------- Stats ----------------
+    uint32_t bulkReads = 0; // số lần read(buf, len) xuống client
+    uint32_t bytesRead = 0;
+
+    explicit BufferedReadClient(Client &c)
+        : client(c) {}
+
+    // ---------------- Connection ----------------
+    int connect(IPAddress ip, uint16_t port) override
+    {
+        discardBuffered();
+        return client.connect(ip, port);
+    }
+
+    int connect(const char *host, uint16_t port) override
+    {
+        discardBuffered();
+        return client.connect(host, port);
+    }
+
+    void stop() override
+    {
+        discardBuffered();
+        client.stop();
+    }
+
+    uint8_t connected() override
+    {
+        // còn byte trong buffer thì vẫn coi như "connected" (giống Client chuẩn)
+        return rxLen > 0 || client.connected();
+    }
+
+    operator bool() override
+    {
+        return connected();
+    }
+
+    // ---------------- Write (pass-through) ----------------
+    size_t write(uint8_t b) override
+    {
+        return client.write(b);
+    }
+
+    size_t write(const uint8_t *buf, size_t size) override
+    {
+        return client.write(buf, size);
+    }
+
+    void flush() override
+    {
+        client.flush();
+    }
+
+    // ---------------- Read (bulk) ----------------
+    int available() override
+    {
+        if (rxLen > 0)
+            return rxLen;
+        return client.available();
+    }
+
+    int read() override
+    {
+        if (rxLen == 0 && !fill())
+            return -1;
+
+        uint8_t b = rxBuf[rxHead++];
+        rxLen--;
+        return b;
+    }
+
+    int read(uint8_t *buf, size_t size) override
+    {
+        size_t cnt = 0;
+
+        // trước hết trả phần đã buffer
+        while (cnt < size && rxLen > 0)
+        {
+            buf[cnt++] = rxBuf[rxHead++];
+            rxLen--;
+        }
+
+        // phần còn lại đọc thẳng vào buffer của caller
+        if (cnt < size)
+        {
+            int n = client.read(buf + cnt, size - cnt);
+            if (n > 0)
+            {
+                bulkReads++;
+                bytesRead += n;
+                cnt += n;
+            }
+        }
+        return (int)cnt;
+    }
+
+    int peek() override
+    {
+        if (rxLen == 0 && !fill())
+            return -1;
+        return rxBuf[rxHead];
+    }
+
+private:
+    bool fill()
+    {
+        if (client.available() <= 0)
+            return false;
+
+        int n = client.read(rxBuf, BUFFERED_READ_CLIENT_SIZE);
+        if (n <= 0)
+            return false;
+
+        bulkReads++;
+        bytesRead += n;
+        rxHead = 0;
+        rxLen = (uint8_t)n;
+        return true;
+    }
+
+    void discardBuffered()
+    {
+        rxHead = 0;
+        rxLen = 0;
+    }
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * CountingPrint
+ *
+ * Print "giả": không ghi đi đâu, chỉ đếm số byte. Dùng để chạy
+ * printTo() một lượt khô (dry-run) lấy đúng Content-Length trước khi
+ * serialize body thật thẳng vào socket.
+ */
+struct CountingPrint : public Print
+{
+    size_t count = 0;
+
+    size_t write(uint8_t) override
+    {
+        count++;
+        return 1;
+    }
+
+    size_t write(const uint8_t *, size_t len) override
+    {
+        count += len;
+        return len;
+    }
+
+    static size_t measure(const Printable &p)
+    {
+        CountingPrint c;
+        p.printTo(c);
+        return c.count;
+    }
+};
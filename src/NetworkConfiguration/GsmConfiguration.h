@@ -5,13 +5,27 @@
 #include <TinyGsmClient.h>
 #include <PubSubClient.h>
 #include <time.h>
+#include <EEPROM.h>
 #include "Domains/Telemetry.h"
+#include "StorageConfiguration/EepromLayout.h"
+#include "StorageConfiguration/EepromJournal.h"
+#include "NetworkConfiguration/BufferedReadClient.h"
+#include "SerialConfiguration/BufferedUart.h"
 #include "Domains/CellInfo.h"
 
+// -----------------------------------------------------------
+// Baud UART modem cố định 115200 (mặc định của SIM7600). Đã thử dò
+// rate cao hơn lúc boot (AT+IPREX + echo test): Mega 16 MHz + U2X chỉ
+// tạo đúng 500000 / 1000000, các rate chuẩn khác lệch 3.5–8.5%, và
+// SIM7600 từ chối cả hai → lần nào cũng về 115200, chỉ tốn round trip
+// mỗi boot. 115200 ≈ 11 KB/s vẫn dư cho MQTT + HTTP + AT task.
+// -----------------------------------------------------------
+static const uint32_t GSM_BAUD = 115200;
+
 struct GsmConfiguration
 {
     // --- Config ---
-    HardwareSerial &serialAT;
+    BufferedUart &serialAT;   // USART2, ring RX 512 B + error counters
     const char *apn;
     const char *gprsUser;
     const char *gprsPass;
@@ -22,12 +36,21 @@ struct GsmConfiguration
     const char *mqttPass;
 
     // --- GSM + MQTT objects ---
+    // SIM7600 supports several TCP sockets (mux 0..9):
+    //   mux 0 -> MQTT (long-lived)
+    //   mux 1 -> HTTP (short requests, e.g. UnwiredLabs)
+    // => HTTP không còn phải ngắt MQTT nữa.
+    static const uint8_t MQTT_MUX = 0;
+    static const uint8_t HTTP_MUX = 1;
+
     TinyGsm modem;
-    TinyGsmClient netClient; // shared for MQTT + HTTP
+    TinyGsmClient netClient;  // MQTT socket
+    TinyGsmClient httpClient; // HTTP socket
+    BufferedReadClient mqttRx; // bulk-read wrapper quanh netClient cho PubSubClient
     PubSubClient mqtt;
 
     GsmConfiguration(
-        HardwareSerial &serial,
+        BufferedUart &serial,
         const char *apn,
         const char *gprsUser,
         const char *gprsPass,
@@ -44,36 +67,22 @@ struct GsmConfiguration
           mqttUser(mqttUser),
           mqttPass(mqttPass),
           modem(serial),
-          netClient(modem),
-          mqtt(netClient)
+          netClient(modem, MQTT_MUX),
+          httpClient(modem, HTTP_MUX),
+          mqttRx(netClient),
+          mqtt(mqttRx)
     {
     }
 
     // =====================================================
     // 1) MODEM / NETWORK SETUP (blocking, called in setup)
     // =====================================================
-    bool setupModemBlocking(uint32_t baud = 115200)
+    bool setupModemBlocking(uint32_t baud = GSM_BAUD)
     {
         Serial.println(F("[GSM] Starting modem..."));
-        serialAT.begin(baud);
-        delay(800);
 
-        // Flush RX
-        while (serialAT.available())
-            serialAT.read();
-
-        Serial.println(F("[GSM] AT handshake..."));
-        bool atOk = false;
-        for (int i = 0; i < 10; i++)
-        {
-            if (modem.testAT())
-            {
-                atOk = true;
-                break;
-            }
-            delay(500);
-        }
-        if (!atOk)
+        migrateStoredBaud(baud);
+        if (!beginAndHandshake(baud, 10))
         {
             Serial.println(F("[GSM] AT handshake FAILED"));
             return false;
@@ -106,6 +115,125 @@ struct GsmConfiguration
         return true;
     }
 
+    // =====================================================
+    // 1b) UART BAUD
+    // =====================================================
+
+    // Bản firmware trước lưu rate dò được (AT+IPREX, modem giữ trong NV)
+    // vào EEPROM_MODEM_BAUD_ADDR → nếu cao hơn 115200, nói chuyện ở rate đó
+    // một lần để đưa modem về rồi xoá bản ghi.
+    static const uint16_t BAUD_EEPROM_MAGIC = 0xB4D0;
+
+    void migrateStoredBaud(uint32_t baud)
+    {
+        uint16_t magic;
+        uint32_t stored;
+        {
+            EepromLock lock;
+            EEPROM.get(EEPROM_MODEM_BAUD_ADDR, magic);
+            EEPROM.get(EEPROM_MODEM_BAUD_ADDR + sizeof(uint16_t), stored);
+        }
+        if (magic != BAUD_EEPROM_MAGIC)
+            return;
+
+        if (stored > baud && beginAndHandshake(stored, 4))
+        {
+            modem.sendAT("+IPREX=", baud);
+            modem.waitResponse(1000);
+            serialAT.flush();
+        }
+
+        EepromLock lock;
+        magic = 0;
+        EEPROM.put(EEPROM_MODEM_BAUD_ADDR, magic);
+    }
+
+    bool beginAndHandshake(uint32_t rate, uint8_t attempts)
+    {
+        serialAT.begin(rate);
+        delay(800);
+
+        // Flush RX
+        while (serialAT.available())
+            serialAT.read();
+
+        Serial.print(F("[GSM] AT handshake @"));
+        Serial.println(rate);
+        for (uint8_t i = 0; i < attempts; i++)
+        {
+            if (modem.testAT(500))
+                return true;
+            delay(500);
+        }
+        return false;
+    }
+
+    // =====================================================
+    // 1c) AT command từ NetworkTask (CSQ, CPSI, CGPS…)
+    //
+    // Không xoá RX trước khi gửi: byte đang chờ có thể là URC của socket
+    // MQTT / HTTP (+CIPRXGET: 1, +IPCLOSE…) → modem.maintain() để TinyGsm
+    // xử lý. Response đọc từng phần mỗi lần execute(), không chờ
+    // waitResponse(): URC socket chen giữa bị bỏ khỏi resp – TinyGsm vẫn
+    // thấy data / socket đóng nhờ lần hỏi +CIPRXGET mỗi 500 ms trong
+    // maintain().
+    // =====================================================
+
+    void sendTaskAT(const char *cmd)
+    {
+        modem.maintain();
+        modem.sendAT(cmd);
+    }
+
+    // Nối byte đang có vào resp (member của task, xoá khi gửi lệnh mới),
+    // không chờ. 0 = chưa gặp dòng kết thúc (gọi lại vòng sau),
+    // 1 = OK, 2 = ERROR / +CME ERROR. Timeout do task tự đếm.
+    int8_t pollTaskResponse(String &resp)
+    {
+        while (modem.stream.available())
+        {
+            char c = modem.stream.read();
+            resp += c;
+            if (c != '\n')
+                continue;
+
+            int start = resp.lastIndexOf('\n', resp.length() - 2) + 1;
+            const char *line = resp.c_str() + start;
+
+            if (isSocketUrc(line))
+            {
+                resp.remove(start);
+                continue;
+            }
+            if (strncmp(line, "OK\r", 3) == 0)
+                return 1;
+            if (strncmp(line, "ERROR", 5) == 0 || strncmp(line, "+CME ERROR", 10) == 0)
+                return 2;
+        }
+        return 0;
+    }
+
+    static bool isSocketUrc(const char *line)
+    {
+        return strncmp(line, "+CIPRXGET: 1", 12) == 0 ||
+               strncmp(line, "+RECEIVE", 8) == 0 ||
+               strncmp(line, "+IPCLOSE", 8) == 0 ||
+               strncmp(line, "+CIPEVENT", 9) == 0;
+    }
+
+    // Dòng bắt đầu bằng prefix trong response nhiều dòng, "" nếu không có
+    static String responseLine(const String &resp, const char *prefix)
+    {
+        int start = resp.indexOf(prefix);
+        if (start < 0)
+            return String();
+
+        int end = resp.indexOf('\n', start);
+        String line = (end < 0) ? resp.substring(start) : resp.substring(start, end);
+        line.trim();
+        return line;
+    }
+
     // =====================================================
     // 2) MQTT Keep-alive (very small “state machine”)
     // =====================================================
@@ -160,6 +288,14 @@ struct GsmConfiguration
         return mqtt.connected();
     }
 
+    void printStats()
+    {
+        Serial.print(F("[GSM] mqttRxBytes="));
+        Serial.print(mqttRx.bytesRead);
+        Serial.print(F(" mqttRxBulkReads="));
+        Serial.println(mqttRx.bulkReads);
+    }
+
     // =====================================================
     // 3) Telemetry publish (fast, no internal state)
     // =====================================================
@@ -178,7 +314,14 @@ struct GsmConfiguration
             return false;
         }
 
-        bool ok = mqtt.publish(topic, data, len);
+        // payload lớn hơn buffer PubSubClient (alert kèm trace...) → stream
+        bool ok;
+        if (len + strlen(topic) + 7 > mqtt.getBufferSize())
+            ok = mqtt.beginPublish(topic, len, false) &&
+                 mqtt.write(data, len) == len &&
+                 mqtt.endPublish();
+        else
+            ok = mqtt.publish(topic, data, len);
 
         if (!ok)
         {
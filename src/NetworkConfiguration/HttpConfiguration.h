@@ -3,14 +3,117 @@
 #include <Arduino.h>
 #include <TinyGsmClient.h>
 #include <PubSubClient.h>
+#include "NetworkConfiguration/BufferedClient.h"
+#include "NetworkConfiguration/CountingPrint.h"
+#include "NetworkConfiguration/HttpResponseParser.h"
+
+#ifndef HTTP_BODY_BUFFER_SIZE
+#define HTTP_BODY_BUFFER_SIZE 384
+#endif
 
 struct HttpConfiguration
 {
-    TinyGsmClient &netClient;
-    PubSubClient *mqtt;            // optional, có thể nullptr
+    TinyGsmClient &netClient;      // dedicated HTTP socket (GsmConfiguration::httpClient)
+    PubSubClient *mqtt;            // optional, chỉ dùng để thống kê, có thể nullptr
     unsigned long httpTimeoutMs = 10000;  // default 10s (can be set from GsmConfiguration)
+    BufferedClient out;            // gom request thành 1 lần CIPSEND
     explicit HttpConfiguration(TinyGsmClient &client, PubSubClient *mqttClient = nullptr)
-        : netClient(client), mqtt(mqttClient) {}
+        : netClient(client), mqtt(mqttClient), out(client) {}
+
+    // ---------------- Stats ----------------
+    // Trước đây HTTP dùng chung socket với MQTT nên mỗi request phải
+    // mqtt->disconnect() rồi reconnect lại (TCP + CONNECT + resubscribe).
+    // Giờ HTTP chạy trên socket riêng → đếm số lần reconnect đã tránh được.
+    uint32_t httpRequestCount      = 0;
+    uint32_t mqttReconnectsAvoided = 0;
+    uint32_t lastSendLatencyMs     = 0; // request line → body đã xuống modem
+
+    // RX stats cho request hiện tại (bulk read)
+    uint32_t rxBytes       = 0;
+    uint32_t rxReads       = 0;
+    uint32_t rxFirstByteMs = 0;
+    uint32_t rxLastByteMs  = 0;
+
+    void countRequestStart()
+    {
+        httpRequestCount++;
+        if (mqtt && mqtt->connected())
+        {
+            mqttReconnectsAvoided++;
+        }
+    }
+
+    uint32_t mqttReconnectsAvoidedPerHour() const
+    {
+        uint32_t upMs = millis();
+        if (upMs < 1000UL)
+            return 0;
+        return (uint32_t)((uint64_t)mqttReconnectsAvoided * 3600000ULL / upMs);
+    }
+
+    void printStats()
+    {
+        Serial.print(F("[HTTP] requests="));
+        Serial.print(httpRequestCount);
+        Serial.print(F(" mqttReconnectsAvoided="));
+        Serial.print(mqttReconnectsAvoided);
+        Serial.print(F(" (~"));
+        Serial.print(mqttReconnectsAvoidedPerHour());
+        Serial.print(F("/h) lastSendMs="));
+        Serial.println(lastSendLatencyMs);
+        printKeepAliveStats();
+    }
+
+    void resetRxStats()
+    {
+        rxBytes = 0;
+        rxReads = 0;
+        rxFirstByteMs = 0;
+        rxLastByteMs = 0;
+    }
+
+    void printRxStats()
+    {
+        if (rxBytes == 0)
+        {
+            Serial.println(F("[HTTP] rx timeout, no bytes"));
+            return;
+        }
+
+        uint32_t spanMs = rxLastByteMs - rxFirstByteMs;
+        Serial.print(F("[HTTP] rx bytes="));
+        Serial.print(rxBytes);
+        Serial.print(F(" reads="));
+        Serial.print(rxReads);
+        Serial.print(F(" ms="));
+        Serial.print(spanMs);
+        if (spanMs > 0)
+        {
+            Serial.print(F(" B/s="));
+            Serial.print((uint32_t)((uint64_t)rxBytes * 1000ULL / spanMs));
+        }
+        Serial.println();
+    }
+
+    // Gửi phần request đã gom trong `out` xuống modem, ghi lại latency
+    bool finishRequestSend(uint32_t sendStartMs)
+    {
+        bool ok = out.sendBuffered();
+        lastSendLatencyMs = millis() - sendStartMs;
+
+        Serial.print(F("[HTTP] request sent: writes="));
+        Serial.print(out.writeCalls);
+        Serial.print(F(" modemSends="));
+        Serial.print(out.modemSends);
+        Serial.print(F(" ms="));
+        Serial.println(lastSendLatencyMs);
+
+        if (!ok)
+        {
+            Serial.println(F("[HTTP] write to modem failed"));
+        }
+        return ok;
+    }
 
     // ---------------- URL helpers ----------------
 
@@ -71,113 +174,294 @@ struct HttpConfiguration
     HttpState      httpState       = HTTP_IDLE;
     unsigned long  httpStartMs     = 0;
     unsigned long  httpEffectiveMs = 0;   // timeout used for current request
-    String         httpResponseBuf;
+    HttpResponseParser httpParser;        // status/headers/body streaming
+    HttpResponseParser::BodyCallback httpBodyCb = nullptr; // optional: body → callback thay vì buffer
+    void          *httpBodyCtx     = nullptr;
+    char           httpBodyBuf[HTTP_BODY_BUFFER_SIZE] = {0}; // body only, NUL-terminated
     String         httpHost;
     int            httpPort        = 80;
     String         httpPath;
     String         httpBody;
+    const Printable *httpBodyWriter = nullptr; // body serialize thẳng vào socket (thay cho httpBody)
     bool           httpIsPost      = false;
 
     // ===================================================
-    //  Start HTTP POST JSON (non-blocking)
-    //  - Returns false if already busy
-    //  - timeoutOverrideMs == 0 => use httpTimeoutMs
+    //  Keep-alive connection (HTTP/1.1)
+    //
+    //  - Một socket HTTP được giữ mở, khoá theo host:port.
+    //  - Request kế tiếp cùng host:port trong keepAliveIdleMs → dùng lại
+    //    (bỏ qua DNS + TCP handshake trên mạng di động).
+    //  - Server đóng (Connection: close / timeout phía server) → gửi trên
+    //    socket cũ thất bại → tự mở lại và gửi lại đúng một lần. Sau khi
+    //    đã gửi xong chỉ GET được gửi lại (socket đóng trước byte đầu);
+    //    POST không bao giờ gửi lại (có thể đã được xử lý / tính phí).
     // ===================================================
 
-    bool startHttpPostJson(const char *url, const String &jsonBody, uint32_t timeoutOverrideMs = 0)
+    bool          keepAliveEnabled = true;
+    unsigned long keepAliveIdleMs  = 15000; // đóng socket nếu rảnh quá lâu
+    String        connHost;                 // host:port của socket đang mở
+    int           connPort        = 0;
+    bool          connOpen        = false;
+    unsigned long connLastUseMs   = 0;
+    bool          connReused      = false;  // request hiện tại chạy trên socket cũ
+    bool          connRetried     = false;  // đã reconnect + gửi lại 1 lần
+
+    uint32_t connNewCount    = 0;
+    uint32_t connReuseCount  = 0;
+    uint32_t connRetryCount  = 0;
+
+    // latency (ms) từ lúc start request → response xong, 16 mẫu gần nhất
+    static const uint8_t LATENCY_SAMPLES = 16;
+    uint16_t latencyMs[LATENCY_SAMPLES] = {0};
+    uint8_t  latencyCount = 0;
+    uint8_t  latencyHead  = 0;
+    unsigned long requestStartMs = 0;
+
+    void recordLatency(uint32_t ms)
     {
-        if (httpState != HTTP_IDLE)
+        latencyMs[latencyHead] = (ms > 0xFFFF) ? 0xFFFF : (uint16_t)ms;
+        latencyHead = (latencyHead + 1) % LATENCY_SAMPLES;
+        if (latencyCount < LATENCY_SAMPLES)
+            latencyCount++;
+    }
+
+    uint16_t medianLatencyMs() const
+    {
+        if (latencyCount == 0)
+            return 0;
+
+        uint16_t sorted[LATENCY_SAMPLES];
+        memcpy(sorted, latencyMs, sizeof(sorted));
+        // insertion sort trên latencyCount phần tử (nhỏ)
+        for (uint8_t i = 1; i < latencyCount; i++)
         {
-            Serial.println(F("[HTTP] Busy, cannot start new POST"));
-            return false;
+            uint16_t v = sorted[i];
+            int8_t j = i - 1;
+            while (j >= 0 && sorted[j] > v)
+            {
+                sorted[j + 1] = sorted[j];
+                j--;
+            }
+            sorted[j + 1] = v;
         }
+        return sorted[latencyCount / 2];
+    }
 
-        if (mqtt)
+    uint32_t requestsPerMinute() const
+    {
+        uint32_t upMs = millis();
+        if (upMs < 1000UL)
+            return 0;
+        return (uint32_t)((uint64_t)httpRequestCount * 60000ULL / upMs);
+    }
+
+    void printKeepAliveStats()
+    {
+        Serial.print(F("[HTTP] keepAlive="));
+        Serial.print(keepAliveEnabled ? F("on") : F("off"));
+        Serial.print(F(" req/min="));
+        Serial.print(requestsPerMinute());
+        Serial.print(F(" medianMs="));
+        Serial.print(medianLatencyMs());
+        Serial.print(F(" newConn="));
+        Serial.print(connNewCount);
+        Serial.print(F(" reused="));
+        Serial.print(connReuseCount);
+        Serial.print(F(" retried="));
+        Serial.println(connRetryCount);
+    }
+
+    void closeConnection()
+    {
+        if (connOpen)
         {
-            mqtt->disconnect(); // shared client: stop MQTT before HTTP
+            netClient.stop();
         }
+        connOpen = false;
+        connHost = "";
+        connPort = 0;
+    }
 
-        httpHost = urlHost(url);
-        httpPort = urlPort(url);
-        httpPath = urlPath(url);
-        httpBody = jsonBody;
-        httpIsPost = true;
+    // Đóng socket keep-alive nếu rảnh quá keepAliveIdleMs
+    void closeIdleConnection()
+    {
+        if (connOpen && httpState == HTTP_IDLE &&
+            millis() - connLastUseMs > keepAliveIdleMs)
+        {
+            Serial.println(F("[HTTP] keep-alive idle timeout, closing"));
+            closeConnection();
+        }
+    }
 
-        httpResponseBuf = "";
-        httpEffectiveMs = (timeoutOverrideMs > 0) ? timeoutOverrideMs : httpTimeoutMs;
+    bool ensureConnection()
+    {
+        connReused = false;
 
-        Serial.print(F("[HTTP] POST "));
-        Serial.print(httpHost);
-        Serial.print(F(":"));
-        Serial.print(httpPort);
-        Serial.println(httpPath);
+        if (keepAliveEnabled && connOpen &&
+            connPort == httpPort && connHost == httpHost &&
+            millis() - connLastUseMs <= keepAliveIdleMs &&
+            netClient.connected())
+        {
+            connReused = true;
+            connReuseCount++;
+            return true;
+        }
+
+        closeConnection();
 
         if (!netClient.connect(httpHost.c_str(), httpPort))
         {
             Serial.println(F("[HTTP] connect failed"));
-            httpState = HTTP_ERROR;
             return false;
         }
 
-        netClient.print(String("POST ") + httpPath + " HTTP/1.1\r\n");
-        netClient.print(String("Host: ") + httpHost + "\r\n");
-        netClient.print("Content-Type: application/json\r\n");
-        netClient.print(String("Content-Length: ") + httpBody.length() + "\r\n");
-        netClient.print("Connection: close\r\n\r\n");
-        netClient.print(httpBody);
-
-        httpStartMs = millis();
-        httpState   = HTTP_READING;
-
+        connOpen = true;
+        connHost = httpHost;
+        connPort = httpPort;
+        connLastUseMs = millis();
+        connNewCount++;
         return true;
     }
 
-    // (Optional) non-blocking GET with same pattern
-    bool startHttpGet(const char *url, uint32_t timeoutOverrideMs = 0)
+    // Gửi request hiện tại (httpIsPost / httpPath / httpHost / httpBody | httpBodyWriter)
+    bool sendRequest()
     {
-        if (httpState != HTTP_IDLE)
+        uint32_t sendStartMs = millis();
+        out.reset();
+        out.resetStats();
+        out.print(httpIsPost ? F("POST ") : F("GET "));
+        out.print(httpPath);
+        out.print(F(" HTTP/1.1\r\nHost: "));
+        out.print(httpHost);
+        if (httpIsPost)
         {
-            Serial.println(F("[HTTP] Busy, cannot start new GET"));
-            return false;
+            out.print(F("\r\nContent-Type: application/json\r\nContent-Length: "));
+            // writer: dry-run đếm byte trước, body thật ghi sau header
+            out.print(httpBodyWriter ? CountingPrint::measure(*httpBodyWriter)
+                                     : httpBody.length());
         }
-
-        if (mqtt)
+        out.print(keepAliveEnabled ? F("\r\nConnection: keep-alive\r\n\r\n")
+                                   : F("\r\nConnection: close\r\n\r\n"));
+        if (httpIsPost)
         {
-            mqtt->disconnect();
+            if (httpBodyWriter)
+                httpBodyWriter->printTo(out);
+            else
+                out.print(httpBody);
         }
 
+        return finishRequestSend(sendStartMs);
+    }
+
+    // Kết nối (hoặc dùng lại) + gửi; socket cũ hỏng ngay lúc gửi (request
+    // chưa đi trọn → server chưa xử lý) → mở mới, gửi lại 1 lần
+    bool connectAndSend()
+    {
+        if (!ensureConnection())
+            return false;
+
+        if (sendRequest())
+            return true;
+
+        if (!connReused)
+            return false;
+
+        return retryOnFreshConnection();
+    }
+
+    bool retryOnFreshConnection()
+    {
+        Serial.println(F("[HTTP] reused connection dropped, reconnecting"));
+        connRetried = true;
+        connRetryCount++;
+        closeConnection();
+
+        beginResponse();
+        resetRxStats();
+
+        if (!ensureConnection())
+            return false;
+        return sendRequest();
+    }
+
+    bool startRequest(bool isPost, const char *url, const String &body, uint32_t timeoutOverrideMs,
+                      const Printable *bodyWriter = nullptr)
+    {
+        countRequestStart();
+
         httpHost = urlHost(url);
         httpPort = urlPort(url);
         httpPath = urlPath(url);
-        httpBody = "";
-        httpIsPost = false;
+        httpBody = body;
+        httpBodyWriter = bodyWriter;
+        httpIsPost = isPost;
+        connRetried = false;
 
-        httpResponseBuf = "";
+        beginResponse();
+        resetRxStats();
         httpEffectiveMs = (timeoutOverrideMs > 0) ? timeoutOverrideMs : httpTimeoutMs;
+        requestStartMs = millis();
 
-        Serial.print(F("[HTTP] GET "));
+        Serial.print(isPost ? F("[HTTP] POST ") : F("[HTTP] GET "));
         Serial.print(httpHost);
         Serial.print(F(":"));
         Serial.print(httpPort);
         Serial.println(httpPath);
 
-        if (!netClient.connect(httpHost.c_str(), httpPort))
+        if (!connectAndSend())
         {
-            Serial.println(F("[HTTP] connect failed"));
+            closeConnection();
             httpState = HTTP_ERROR;
             return false;
         }
 
-        netClient.print(String("GET ") + httpPath + " HTTP/1.1\r\n");
-        netClient.print(String("Host: ") + httpHost + "\r\n");
-        netClient.print("Connection: close\r\n\r\n");
-
         httpStartMs = millis();
         httpState   = HTTP_READING;
-
         return true;
     }
 
+    // ===================================================
+    //  Start HTTP POST JSON (non-blocking)
+    //  - Returns false if already busy
+    //  - timeoutOverrideMs == 0 => use httpTimeoutMs
+    // ===================================================
+
+    bool startHttpPostJson(const char *url, const String &jsonBody, uint32_t timeoutOverrideMs = 0)
+    {
+        if (httpState != HTTP_IDLE)
+        {
+            Serial.println(F("[HTTP] Busy, cannot start new POST"));
+            return false;
+        }
+
+        return startRequest(true, url, jsonBody, timeoutOverrideMs);
+    }
+
+    // POST với body là Printable: không copy vào String, Content-Length
+    // lấy bằng dry-run. `body` phải sống tới khi request xong (resetHttp).
+    bool startHttpPostJson(const char *url, const Printable &body, uint32_t timeoutOverrideMs = 0)
+    {
+        if (httpState != HTTP_IDLE)
+        {
+            Serial.println(F("[HTTP] Busy, cannot start new POST"));
+            return false;
+        }
+
+        return startRequest(true, url, String(), timeoutOverrideMs, &body);
+    }
+
+    // (Optional) non-blocking GET with same pattern
+    bool startHttpGet(const char *url, uint32_t timeoutOverrideMs = 0)
+    {
+        if (httpState != HTTP_IDLE)
+        {
+            Serial.println(F("[HTTP] Busy, cannot start new GET"));
+            return false;
+        }
+
+        return startRequest(false, url, String(), timeoutOverrideMs);
+    }
+
     // ===================================================
     //  Step HTTP (non-blocking)
     //  - Call this every loop()
@@ -186,36 +470,115 @@ struct HttpConfiguration
 
     void stepHttp()
     {
+        if (httpState == HTTP_IDLE)
+        {
+            closeIdleConnection();
+            return;
+        }
+
         if (httpState != HTTP_READING)
             return;
 
-        // read all available bytes
-        while (netClient.available())
+        // read all available bytes, theo khối thay vì từng byte
+        uint8_t chunk[64];
+        while (netClient.available() > 0)
         {
-            char c = netClient.read();
-            httpResponseBuf += c;
+            int n = netClient.read(chunk, sizeof(chunk));
+            if (n <= 0)
+                break;
+
+            uint32_t nowMs = millis();
+            if (rxBytes == 0)
+                rxFirstByteMs = nowMs;
+            rxLastByteMs = nowMs;
+            rxBytes += n;
+            rxReads++;
+
+            httpParser.feed(chunk, n);
 
             // reset timeout each time we get data
-            httpStartMs = millis();
+            httpStartMs = nowMs;
+
+            if (httpParser.isFinished())
+                break;
+        }
+
+        // Content-Length / chunk 0 đã đủ → xong ngay, không đợi đóng socket
+        if (httpParser.isFinished())
+        {
+            finishHttp();
+            return;
         }
 
         // check timeout or disconnected
         if (!netClient.connected() || (millis() - httpStartMs > httpEffectiveMs))
         {
-            netClient.stop();  // ⛔ hard cut: modem stops listening to this TCP session
-
-            if (httpResponseBuf.length() == 0)
-            {
-                Serial.println(F("[HTTP] empty response or timeout"));
-                httpState = HTTP_ERROR;
-            }
-            else
+            // socket keep-alive bị server đóng trước khi trả lời → thử lại,
+            // chỉ với GET. POST đã gửi xong có thể đã tới server (UnwiredLabs
+            // tính phí mỗi request) → không gửi lại; timeout cũng không.
+            if (!httpIsPost && connReused && !connRetried && rxBytes == 0 &&
+                !netClient.connected())
             {
-                httpState = HTTP_DONE;
+                if (retryOnFreshConnection())
+                {
+                    httpStartMs = millis();
+                    return;
+                }
             }
+
+            httpParser.onEof();
+            finishHttp();
         }
     }
 
+    // Body sink cho request kế tiếp: callback (nếu có) hoặc buffer cố định
+    void setBodyCallback(HttpResponseParser::BodyCallback cb, void *ctx)
+    {
+        httpBodyCb = cb;
+        httpBodyCtx = ctx;
+    }
+
+    void beginResponse()
+    {
+        httpBodyBuf[0] = 0;
+        if (httpBodyCb)
+            httpParser.begin(httpBodyCb, httpBodyCtx);
+        else
+            httpParser.begin(httpBodyBuf, sizeof(httpBodyBuf));
+    }
+
+    void finishHttp()
+    {
+        // Giữ socket cho request sau nếu response trọn vẹn và server không
+        // yêu cầu đóng; ngược lại cắt hẳn (modem stops listening).
+        if (keepAliveEnabled && httpParser.isDone() && !httpParser.connectionClose &&
+            netClient.connected())
+        {
+            connLastUseMs = millis();
+        }
+        else
+        {
+            closeConnection();
+        }
+
+        recordLatency(millis() - requestStartMs);
+        printRxStats();
+
+        if (!httpParser.isDone())
+        {
+            Serial.println(F("[HTTP] incomplete response or timeout"));
+            httpState = HTTP_ERROR;
+            return;
+        }
+
+        if (httpParser.bodyTruncated)
+        {
+            Serial.print(F("[HTTP] body truncated, len="));
+            Serial.println(httpParser.bodyLen);
+        }
+        httpState = HTTP_DONE;
+    }
+
     // ===================================================
     //  Query helpers
     // ===================================================
@@ -230,23 +593,41 @@ struct HttpConfiguration
         return httpState == HTTP_DONE || httpState == HTTP_ERROR;
     }
 
+    // Response đầy đủ (mọi status, như trước khi có parser); caller cần
+    // phân biệt 2xx / 3xx / 4xx thì đọc getHttpStatus()
     bool isHttpOk() const
     {
         return httpState == HTTP_DONE;
     }
 
-    String getHttpResult() const
+    int getHttpStatus() const
+    {
+        return httpParser.statusCode;
+    }
+
+    // Body (không có header), NUL-terminated, nằm trong buffer cố định
+    const char *getHttpBody() const
+    {
+        return httpBodyBuf;
+    }
+
+    size_t getHttpBodyLength() const
     {
-        return httpResponseBuf;
+        size_t len = httpParser.bodyLen;
+        return (len < sizeof(httpBodyBuf)) ? len : sizeof(httpBodyBuf) - 1;
     }
 
     void resetHttp()
     {
         httpState       = HTTP_IDLE;
-        httpResponseBuf = "";
+        httpParser.reset();
+        httpBodyBuf[0]  = 0;
+        httpBodyCb      = nullptr;
+        httpBodyCtx     = nullptr;
         httpHost        = "";
         httpPath        = "";
         httpBody        = "";
+        httpBodyWriter  = nullptr;
         httpIsPost      = false;
         httpPort        = 80;
         httpEffectiveMs = 0;
@@ -0,0 +1,309 @@
+#pragma once
+#include <Arduino.h>
+
+#ifndef HTTP_PARSER_LINE_SIZE
+#define HTTP_PARSER_LINE_SIZE 40
+#endif
+
+/**
+ * HttpResponseParser
+ *
+ * State machine đọc response HTTP/1.x theo từng khối bytes:
+ *   status line → headers → body (Content-Length | chunked | tới khi đóng)
+ *
+ * - Header KHÔNG được lưu lại: chỉ một dòng scratch nhỏ cho header đang
+ *   đọc, lấy Content-Length / Transfer-Encoding / Connection rồi bỏ.
+ * - Body được ghi vào buffer cố định của caller (luôn NUL-terminated)
+ *   hoặc đẩy qua callback.
+ * - Xong ngay khi đủ Content-Length (hoặc chunk 0) – không cần đợi
+ *   server đóng socket hay timeout.
+ */
+struct HttpResponseParser
+{
+    typedef void (*BodyCallback)(const uint8_t *data, size_t len, void *ctx);
+
+    enum State : uint8_t
+    {
+        STATUS_LINE,
+        HEADER_LINE,
+        BODY_LENGTH,      // Content-Length
+        BODY_UNTIL_CLOSE, // không có length → đọc tới khi đóng socket
+        CHUNK_SIZE,
+        CHUNK_DATA,
+        CHUNK_DATA_END,   // CRLF sau mỗi chunk
+        CHUNK_TRAILER,
+        DONE,
+        PARSE_ERROR
+    };
+
+    // ---------------- Results ----------------
+    State    state           = STATUS_LINE;
+    int      statusCode      = 0;
+    int32_t  contentLength   = -1; // -1 = không có header
+    bool     chunked         = false;
+    bool     connectionClose = false;
+    size_t   bodyLen         = 0;  // tổng số byte body đã nhận (kể cả phần bị cắt)
+    bool     bodyTruncated   = false;
+
+    // ---------------- Body sink ----------------
+    char        *bodyBuf = nullptr;
+    size_t       bodyCap = 0;
+    BodyCallback bodyCb  = nullptr;
+    void        *bodyCtx = nullptr;
+
+    // ---------------- Internal ----------------
+    char     line[HTTP_PARSER_LINE_SIZE];
+    uint8_t  lineLen      = 0;
+    bool     lineOverflow = false;
+    uint32_t remaining    = 0; // byte còn lại của body / chunk hiện tại
+
+    // Body → buffer cố định (cap bao gồm NUL)
+    void begin(char *buf, size_t cap)
+    {
+        reset();
+        bodyBuf = buf;
+        bodyCap = cap;
+        if (bodyBuf && bodyCap > 0)
+            bodyBuf[0] = 0;
+    }
+
+    // Body → callback
+    void begin(BodyCallback cb, void *ctx)
+    {
+        reset();
+        bodyCb = cb;
+        bodyCtx = ctx;
+    }
+
+    void reset()
+    {
+        state = STATUS_LINE;
+        statusCode = 0;
+        contentLength = -1;
+        chunked = false;
+        connectionClose = false;
+        bodyLen = 0;
+        bodyTruncated = false;
+        bodyBuf = nullptr;
+        bodyCap = 0;
+        bodyCb = nullptr;
+        bodyCtx = nullptr;
+        lineLen = 0;
+        lineOverflow = false;
+        remaining = 0;
+    }
+
+    bool isDone() const { return state == DONE; }
+    bool isError() const { return state == PARSE_ERROR; }
+    bool isFinished() const { return state == DONE || state == PARSE_ERROR; }
+    bool headersComplete() const { return state > HEADER_LINE; }
+
+    // -------------------------------------------------
+    // Feed một khối bytes. Trả về số byte đã dùng
+    // (< len nếu response kết thúc giữa khối).
+    // -------------------------------------------------
+    size_t feed(const uint8_t *data, size_t len)
+    {
+        size_t i = 0;
+        while (i < len && !isFinished())
+        {
+            switch (state)
+            {
+            case BODY_LENGTH:
+            case CHUNK_DATA:
+            {
+                size_t n = len - i;
+                if (n > remaining)
+                    n = remaining;
+                emitBody(data + i, n);
+                i += n;
+                remaining -= n;
+
+                if (remaining == 0)
+                    state = (state == BODY_LENGTH) ? DONE : CHUNK_DATA_END;
+                break;
+            }
+
+            case BODY_UNTIL_CLOSE:
+                emitBody(data + i, len - i);
+                i = len;
+                break;
+
+            default:
+                feedLineByte((char)data[i++]);
+                break;
+            }
+        }
+        return i;
+    }
+
+    // Server đóng socket / hết dữ liệu
+    void onEof()
+    {
+        if (state == BODY_UNTIL_CLOSE)
+            state = DONE;
+        else if (state != DONE)
+            state = PARSE_ERROR;
+    }
+
+private:
+    void emitBody(const uint8_t *data, size_t n)
+    {
+        if (n == 0)
+            return;
+
+        if (bodyCb)
+        {
+            bodyCb(data, n, bodyCtx);
+        }
+        else if (bodyBuf && bodyCap > 0)
+        {
+            size_t room = (bodyLen < bodyCap - 1) ? (bodyCap - 1 - bodyLen) : 0;
+            size_t copy = (n < room) ? n : room;
+            if (copy > 0)
+            {
+                memcpy(bodyBuf + bodyLen, data, copy);
+                bodyBuf[bodyLen + copy] = 0;
+            }
+            if (copy < n)
+                bodyTruncated = true;
+        }
+        bodyLen += n;
+    }
+
+    // Các state dạng "dòng" (status, header, chunk size, CRLF, trailer)
+    void feedLineByte(char c)
+    {
+        if (c == '\r')
+            return;
+
+        if (c != '\n')
+        {
+            if (lineLen < HTTP_PARSER_LINE_SIZE - 1)
+                line[lineLen++] = c;
+            else
+                lineOverflow = true;
+            return;
+        }
+
+        line[lineLen] = 0;
+        onLine();
+        lineLen = 0;
+        lineOverflow = false;
+    }
+
+    void onLine()
+    {
+        switch (state)
+        {
+        case STATUS_LINE:
+            // "HTTP/1.1 200 OK"
+            if (strncmp(line, "HTTP/", 5) != 0)
+            {
+                state = PARSE_ERROR;
+                return;
+            }
+            {
+                const char *sp = strchr(line, ' ');
+                statusCode = sp ? atoi(sp + 1) : 0;
+                // HTTP/1.0 mặc định đóng kết nối
+                connectionClose = (strncmp(line, "HTTP/1.0", 8) == 0);
+            }
+            state = HEADER_LINE;
+            return;
+
+        case HEADER_LINE:
+            if (lineLen == 0)
+            {
+                onHeadersEnd();
+                return;
+            }
+            if (!lineOverflow)
+                onHeader();
+            return;
+
+        case CHUNK_SIZE:
+        {
+            // "1a3f" hoặc "1a3f;ext=..."
+            char *end = nullptr;
+            unsigned long size = strtoul(line, &end, 16);
+            if (end == line)
+            {
+                state = PARSE_ERROR;
+                return;
+            }
+            if (size == 0)
+            {
+                state = CHUNK_TRAILER;
+                return;
+            }
+            remaining = size;
+            state = CHUNK_DATA;
+            return;
+        }
+
+        case CHUNK_DATA_END:
+            state = CHUNK_SIZE;
+            return;
+
+        case CHUNK_TRAILER:
+            if (lineLen == 0)
+                state = DONE;
+            return;
+
+        default:
+            return;
+        }
+    }
+
+    void onHeader()
+    {
+        char *colon = strchr(line, ':');
+        if (!colon)
+            return;
+        *colon = 0;
+
+        const char *value = colon + 1;
+        while (*value == ' ' || *value == '\t')
+            value++;
+
+        if (strcasecmp(line, "Content-Length") == 0)
+        {
+            contentLength = atol(value);
+        }
+        else if (strcasecmp(line, "Transfer-Encoding") == 0)
+        {
+            chunked = (strstr(value, "chunked") != nullptr ||
+                       strstr(value, "Chunked") != nullptr);
+        }
+        else if (strcasecmp(line, "Connection") == 0)
+        {
+            connectionClose = (strcasecmp(value, "close") == 0);
+        }
+    }
+
+    void onHeadersEnd()
+    {
+        // 1xx / 204 / 304: không có body
+        if ((statusCode >= 100 && statusCode < 200) ||
+            statusCode == 204 || statusCode == 304)
+        {
+            state = DONE;
+            return;
+        }
+
+        if (chunked)
+        {
+            state = CHUNK_SIZE;
+        }
+        else if (contentLength >= 0)
+        {
+            remaining = (uint32_t)contentLength;
+            state = (remaining == 0) ? DONE : BODY_LENGTH;
+        }
+        else
+        {
+            state = BODY_UNTIL_CLOSE;
+        }
+    }
+};
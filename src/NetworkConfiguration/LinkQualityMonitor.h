@@ -0,0 +1,224 @@
+#pragma once
+#include <Arduino.h>
+
+// -----------------------------------------------------------
+// Radio access technology reported by +CPSI
+// -----------------------------------------------------------
+enum class LinkRat : uint8_t
+{
+    UNKNOWN    = 0,
+    NO_SERVICE = 1,
+    GSM        = 2,
+    WCDMA      = 3,
+    LTE        = 4
+};
+
+// -----------------------------------------------------------
+// Coarse link quality bucket (dùng cho scheduler / telemetry)
+// -----------------------------------------------------------
+enum class LinkQuality : uint8_t
+{
+    NONE = 0, // no service / CSQ 99
+    POOR = 1,
+    FAIR = 2,
+    GOOD = 3
+};
+
+/**
+ * LinkQualityMonitor
+ *
+ * - Không tự gửi lệnh AT: LinkQualitySampleTask (low priority) đọc
+ *   +CSQ / +CPSI? qua scheduler rồi đẩy kết quả vào đây.
+ * - Giữ lịch sử nhỏ (HISTORY_LEN mẫu RSSI) + giá trị làm mượt (EWMA,
+ *   fixed-point dBm * 16) để quyết định không bị giật theo từng mẫu.
+ * - Telemetry / scheduler hỏi quality(), telemetryIntervalMs(),
+ *   shouldDeferBulk() để giãn chu kỳ gửi khi sóng yếu.
+ */
+struct LinkQualityMonitor
+{
+    static const uint8_t HISTORY_LEN = 8;
+
+    // RSSI thresholds (dBm) on the smoothed value
+    static const int8_t GOOD_DBM = -85;
+    static const int8_t FAIR_DBM = -95;
+
+    int8_t  history[HISTORY_LEN] = {0};
+    uint8_t historyCount = 0;
+    uint8_t historyHead  = 0;
+
+    int16_t smoothedDbmQ4 = 0;   // dBm * 16
+    bool    hasRssi       = false;
+    bool    sampled       = false;   // đã có ít nhất 1 mẫu +CSQ
+    LinkRat rat           = LinkRat::UNKNOWN;
+    uint32_t lastSampleMs = 0;
+
+    // -------------------------------------------------
+    // +CSQ: <rssi>,<ber>   (rssi 0..31, 99 = unknown)
+    // -------------------------------------------------
+    bool parseCsqLine(const String &line)
+    {
+        int idx = line.indexOf("+CSQ:");
+        if (idx < 0)
+            return false;
+
+        int csq = line.substring(idx + 5).toInt();
+        onCsq(csq);
+        return true;
+    }
+
+    void onCsq(int csq)
+    {
+        lastSampleMs = millis();
+        sampled = true;
+
+        if (csq < 0 || csq > 31)
+        {
+            // 99 = not known / not detectable → count as no signal
+            hasRssi = false;
+            return;
+        }
+
+        int8_t dbm = (int8_t)(-113 + 2 * csq);
+
+        history[historyHead] = dbm;
+        historyHead = (historyHead + 1) % HISTORY_LEN;
+        if (historyCount < HISTORY_LEN)
+            historyCount++;
+
+        if (!hasRssi)
+        {
+            smoothedDbmQ4 = (int16_t)dbm * 16;
+            hasRssi = true;
+        }
+        else
+        {
+            // EWMA alpha = 1/4
+            smoothedDbmQ4 += ((int16_t)dbm * 16 - smoothedDbmQ4) / 4;
+        }
+    }
+
+    // -------------------------------------------------
+    // +CPSI: LTE,Online,452-02,0x1817,...
+    // Chỉ lấy RAT + trạng thái Online.
+    // -------------------------------------------------
+    bool parseCpsiLine(const String &line)
+    {
+        int idx = line.indexOf("+CPSI:");
+        if (idx < 0)
+            return false;
+
+        String payload = line.substring(idx + 6);
+        payload.trim();
+
+        if (payload.startsWith("NO SERVICE"))
+        {
+            rat = LinkRat::NO_SERVICE;
+            return true;
+        }
+
+        int comma = payload.indexOf(',');
+        String sys = (comma < 0) ? payload : payload.substring(0, comma);
+        bool online = payload.indexOf("Online") >= 0;
+
+        if (!online)
+            rat = LinkRat::NO_SERVICE;
+        else if (sys == "LTE")
+            rat = LinkRat::LTE;
+        else if (sys == "WCDMA")
+            rat = LinkRat::WCDMA;
+        else if (sys == "GSM")
+            rat = LinkRat::GSM;
+        else
+            rat = LinkRat::UNKNOWN;
+
+        return true;
+    }
+
+    // ===================================================
+    //  Link-quality API
+    // ===================================================
+
+    int8_t rssiDbm() const
+    {
+        if (!hasRssi)
+            return -128;
+        return (int8_t)(smoothedDbmQ4 / 16);
+    }
+
+    LinkQuality quality() const
+    {
+        // Chưa có mẫu (mẫu đầu ~30 s sau boot): coi là FAIR, không giãn
+        // telemetry / hoãn bulk chỉ vì chưa đo
+        if (!sampled && rat != LinkRat::NO_SERVICE)
+            return LinkQuality::FAIR;
+
+        if (!hasRssi || rat == LinkRat::NO_SERVICE)
+            return LinkQuality::NONE;
+
+        int8_t dbm = rssiDbm();
+        if (dbm >= GOOD_DBM)
+            return LinkQuality::GOOD;
+        if (dbm >= FAIR_DBM)
+            return LinkQuality::FAIR;
+        return LinkQuality::POOR;
+    }
+
+    bool isPoor() const
+    {
+        LinkQuality q = quality();
+        return q == LinkQuality::POOR || q == LinkQuality::NONE;
+    }
+
+    // Telemetry interval scaled by link quality (baseMs when GOOD/FAIR)
+    uint32_t telemetryIntervalMs(uint32_t baseMs) const
+    {
+        switch (quality())
+        {
+        case LinkQuality::GOOD:
+        case LinkQuality::FAIR:
+            return baseMs;
+        case LinkQuality::POOR:
+            return baseMs * 3;
+        default:
+            return baseMs * 6;
+        }
+    }
+
+    // Bulk / non-urgent uploads (HTTP geolocation, track upload…) nên hoãn
+    bool shouldDeferBulk() const
+    {
+        return isPoor();
+    }
+
+    // -------------------------------------------------
+    const char *ratToString() const
+    {
+        switch (rat)
+        {
+        case LinkRat::NO_SERVICE: return "NO_SERVICE";
+        case LinkRat::GSM:        return "GSM";
+        case LinkRat::WCDMA:      return "WCDMA";
+        case LinkRat::LTE:        return "LTE";
+        default:                  return "UNKNOWN";
+        }
+    }
+
+    void printStats()
+    {
+        Serial.print(F("[LINK] rssi="));
+        Serial.print(rssiDbm());
+        Serial.print(F("dBm rat="));
+        Serial.print(ratToString());
+        Serial.print(F(" quality="));
+        Serial.print((int)quality());
+        Serial.print(F(" history=["));
+        for (uint8_t i = 0; i < historyCount; ++i)
+        {
+            uint8_t idx = (historyHead + HISTORY_LEN - historyCount + i) % HISTORY_LEN;
+            Serial.print(history[idx]);
+            if (i + 1 < historyCount)
+                Serial.print(',');
+        }
+        Serial.println(']');
+    }
+};
@@ -0,0 +1,13 @@
+#pragma once
+#include <Arduino.h>
+
+// -----------------------------------------------------------
+// UnwiredLabs LocationAPI
+// Token nằm trong flash (PROGMEM) → không chiếm RAM, in thẳng
+// ra Print bằng LOCATION_API_TOKEN_F khi serialize request.
+// -----------------------------------------------------------
+static const char LOCATION_API_URL[] = "http://eu1.unwiredlabs.com/v2/process.php";
+
+static const char LOCATION_API_TOKEN[] PROGMEM = "pk.934c1ddee8ca7d8db926995b255c9f26";
+
+#define LOCATION_API_TOKEN_F (reinterpret_cast<const __FlashStringHelper *>(LOCATION_API_TOKEN))
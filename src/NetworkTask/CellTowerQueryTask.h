@@ -32,59 +32,45 @@ public:
             markStarted();
 
             successFlag = false;
-            jsonResult  = "";
             cpsiLine    = "";
+            resp        = "";
 
-            // Clean modem RX buffer
-            while (gsm.modem.stream.available())
-            {
-                gsm.modem.stream.read();
-            }
-
-            gsm.modem.sendAT("+CPSI?");
+            // byte đang chờ (URC socket MQTT / HTTP) → TinyGsm xử lý, không xoá
+            gsm.sendTaskAT("+CPSI?");
             Serial.println(F("[CELL] +CPSI? sent (non-blocking task)"));
 
             return; // yield, wait for response in later execute() calls
         }
 
         // ----------------- SUBSEQUENT CALLS: read response -----------------
-        // Drain whatever bytes are available this loop
-        while (gsm.modem.stream.available())
-        {
-            String line = gsm.modem.stream.readStringUntil('\n');
-            line.trim();
-            if (line.length() == 0)
-                continue;
+        // đọc dần, URC socket chen giữa bị pollTaskResponse bỏ qua
+        int8_t r = gsm.pollTaskResponse(resp);
 
+        if (r == 1)
+        {
+            cpsiLine = GsmConfiguration::responseLine(resp, "+CPSI");
             Serial.print(F("[CELL] LINE: "));
-            Serial.println(line);
-
-            if (line.startsWith("+CPSI"))
-            {
-                cpsiLine = line;
-            }
-
-            if (line == "OK")
-            {
-                // End of response → finalize
-                finalizeFromCpsi();
-                markCompleted();
-                return;
-            }
-
-            if (line.indexOf("ERROR") >= 0)
-            {
-                Serial.println(F("[CELL] CPSI ERROR"));
-                successFlag = false;
-                markCompleted();
-                return;
-            }
+            Serial.println(cpsiLine);
+
+            // End of response → finalize
+            finalizeFromCpsi();
+            markCompleted();
+            return;
+        }
+
+        if (r == 2)
+        {
+            Serial.println(F("[CELL] CPSI ERROR"));
+            successFlag = false;
+            markCompleted();
+            return;
         }
 
         // ----------------- TIMEOUT CHECK -----------------
         if (millis() - getStartMs() > timeoutMs)
         {
             Serial.println(F("[CELL] CPSI timeout"));
+            cpsiLine = GsmConfiguration::responseLine(resp, "+CPSI");
             finalizeFromCpsi(); // try to parse if we did get a +CPSI line
             markCompleted();
         }
@@ -92,7 +78,6 @@ public:
 
     // exposed results
     bool success() const { return successFlag; }
-    const String &getJson() const { return jsonResult; }
 
     // optional: reuse base isStarted/isCompleted but keep these aliases if you like
     bool isStartedLocal()   const { return isStarted(); }
@@ -119,8 +104,8 @@ private:
 
     // internal state for this async task
     bool   successFlag = false;
-    String jsonResult;
     String cpsiLine;
+    String resp;   // response đọc dần qua các lần execute()
 
     uint32_t timeoutMs = 2000; // default 2s, ctor may override
 
@@ -139,16 +124,9 @@ private:
         // Fill the provided CellInfo reference
         outCell.parseCpsiLine(cpsiLine);
 
-        jsonResult = outCell.buildLocationApiJson();
-        if (jsonResult.length() == 0)
-        {
-            Serial.println(F("[CELL] buildLocationApiJson returned empty JSON"));
-            successFlag = false;
-            return;
-        }
-
         Serial.println(F("[CELL] Cell JSON:"));
-        Serial.println(jsonResult);
+        outCell.printLocationApiJson(Serial);
+        Serial.println();
 
         successFlag = true;
     }
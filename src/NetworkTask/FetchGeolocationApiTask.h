@@ -1,9 +1,12 @@
 #pragma once
 
 #include <Arduino.h>
+#include <ArduinoJson.h>
 #include "NetworkTask.h"
 #include "NetworkConfiguration/HttpConfiguration.h"
 #include "Domains/CellInfo.h"
+#include "StorageConfiguration/CellLocationCache.h"
+#include "GpsConfiguration/LocationProvider.h"
 
 class QueryGeolocationApiTask : public NetworkTask
 {
@@ -13,16 +16,27 @@ private:
     float &latPtr;       // pointer to output latitude
     float &lonPtr;       // pointer to output longitude
     uint32_t perRequestTimeoutMs = 2000;   // e.g. 2s timeout
+    LocationApiRequestBody body;           // serialize từ cellPtr lúc gửi
+    CellLocationCache *cache;              // optional: lưu kết quả để lần sau khỏi gọi API
+    uint32_t requestUnixS;                 // thời điểm request (tuổi entry trong cache)
+    LocationSource *sourcePtr;             // optional: = CELL khi lat/lon được ghi
 
 public:
     QueryGeolocationApiTask(HttpConfiguration &httpCfg,
                             CellInfo &cellInfo,
                             float &outLat,
-                            float &outLon)
+                            float &outLon,
+                            CellLocationCache *cellCache = nullptr,
+                            uint32_t nowUnixS = 0,
+                            LocationSource *outSource = nullptr)
         : http(httpCfg),
           cellPtr(cellInfo),
           latPtr(outLat),
-          lonPtr(outLon)
+          lonPtr(outLon),
+          body(cellInfo),
+          cache(cellCache),
+          requestUnixS(nowUnixS),
+          sourcePtr(outSource)
     {
     }
 
@@ -36,15 +50,12 @@ public:
 
         
 
-        // -------- 1) First call: build body + start HTTP --------
+        // -------- 1) First call: start HTTP (body streamed from cellPtr) --------
         if (!isStarted())
         {
-
-
-            String body = cellPtr.buildLocationApiJson();
-            if (body.length() == 0)
+            if (cellPtr.mcc <= 0 || cellPtr.lac <= 0 || cellPtr.cid <= 0)
             {
-                Serial.println(F("[GEO] buildLocationApiJson() returned empty body"));
+                Serial.println(F("[GEO] No valid cell info, skip request"));
                 markCompleted();
                 return;
             }
@@ -60,7 +71,7 @@ public:
             
             
             bool ok = http.startHttpPostJson(
-                "http://eu1.unwiredlabs.com/v2/process.php",
+                LOCATION_API_URL,
                 body,
                 perRequestTimeoutMs
             );
@@ -86,70 +97,61 @@ public:
         }
 
         // -------- 3) HTTP finished (OK or ERROR) --------
-        String resp = http.getHttpResult();
-        bool ok     = http.isHttpOk();
-
-        http.resetHttp();   // free HTTP for other tasks
-
-        if (!ok || resp.length() == 0)
+        // parser đã bỏ header, body nằm trong buffer cố định của http
+        if (!http.isHttpOk() || http.getHttpBodyLength() == 0)
         {
+            http.resetHttp();   // free HTTP for other tasks
             Serial.println(F("[GEO] HTTP error or empty response from Unwired Labs"));
             markCompleted();
             return;
         }
 
-        // 4) Strip HTTP headers
-        int headerEnd   = resp.indexOf("\r\n\r\n");
-        String jsonPart = (headerEnd >= 0) ? resp.substring(headerEnd + 4) : resp;
-
         Serial.println(F("[GEO] Raw JSON from server:"));
-        Serial.println(jsonPart);
+        Serial.println(http.getHttpBody());
+
+        // 4) Chỉ lấy các field cần ở top-level (filter) → bộ nhớ cố định,
+        //    không bắt nhầm "lat"/"lon" lồng bên trong object khác.
+        StaticJsonDocument<64> filter;
+        filter["status"]   = true;
+        filter["lat"]      = true;
+        filter["lon"]      = true;
+        filter["accuracy"] = true;
+
+        StaticJsonDocument<128> doc;
+        DeserializationError err = deserializeJson(
+            doc,
+            http.getHttpBody(),
+            http.getHttpBodyLength(),
+            DeserializationOption::Filter(filter));
+
+        http.resetHttp();   // free HTTP for other tasks
 
-        // Optional: status:"ok"
-        int statusIdx = jsonPart.indexOf("\"status\"");
-        if (statusIdx >= 0)
+        if (err)
         {
-            int colon = jsonPart.indexOf(':', statusIdx);
-            if (colon > 0)
-            {
-                String statusVal = jsonPart.substring(colon + 1);
-                statusVal.trim();
-                if (statusVal.indexOf("ok") < 0 && statusVal.indexOf("OK") < 0)
-                {
-                    Serial.println(F("[GEO] status is not ok"));
-                    markCompleted();
-                    return;
-                }
-            }
+            Serial.print(F("[GEO] JSON parse error: "));
+            Serial.println(err.c_str());
+            markCompleted();
+            return;
         }
 
-        // 5) Extract "lat" and "lon"
-        int latIndex = jsonPart.indexOf("\"lat\"");
-        int lonIndex = jsonPart.indexOf("\"lon\"");
-
-        if (latIndex < 0 || lonIndex < 0)
+        const char *status = doc["status"] | "";
+        if (strcasecmp(status, "ok") != 0)
         {
-            Serial.println(F("[GEO] Missing lat/lon fields in JSON"));
+            Serial.println(F("[GEO] status is not ok"));
             markCompleted();
             return;
         }
 
-        int latColon = jsonPart.indexOf(':', latIndex);
-        int lonColon = jsonPart.indexOf(':', lonIndex);
-        if (latColon < 0 || lonColon < 0)
+        if (!doc["lat"].is<float>() || !doc["lon"].is<float>())
         {
-            Serial.println(F("[GEO] Malformed lat/lon fields"));
+            Serial.println(F("[GEO] Missing lat/lon fields in JSON"));
             markCompleted();
             return;
         }
 
-        String latStr = jsonPart.substring(latColon + 1);
-        String lonStr = jsonPart.substring(lonColon + 1);
-        latStr.trim();
-        lonStr.trim();
-
-        float latVal = latStr.toFloat();
-        float lonVal = lonStr.toFloat();
+        float latVal = doc["lat"].as<float>();
+        float lonVal = doc["lon"].as<float>();
+        uint16_t accuracyM = doc["accuracy"] | 0;
 
         if (latVal == 0 && lonVal == 0)
         {
@@ -158,11 +160,19 @@ public:
 
         if (latPtr) latPtr = latVal;
         if (lonPtr) lonPtr = lonVal;
+        if (sourcePtr) *sourcePtr = LocationSource::CELL;
 
         Serial.print(F("[GEO] Parsed lat = "));
         Serial.println(latVal, 6);
         Serial.print(F("[GEO] Parsed lon = "));
         Serial.println(lonVal, 6);
+        Serial.print(F("[GEO] Accuracy (m) = "));
+        Serial.println(accuracyM);
+
+        if (cache && !(latVal == 0 && lonVal == 0))
+        {
+            cache->store(cellPtr, latVal, lonVal, accuracyM, requestUnixS);
+        }
 
         markCompleted();   // one-shot, done
     }
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <Arduino.h>
+#include "NetworkTask.h"
+#include "NetworkConfiguration/GsmConfiguration.h"
+#include "GeofenceConfiguration/GeofenceTileStore.h"
+
+// Forward declaration so global callback can see it
+class GeofenceTileSyncTask;
+extern GeofenceTileSyncTask *g_activeGeofenceSyncTask;
+
+/**
+ * GeofenceTileSyncTask
+ *
+ * Gửi danh sách tile quanh xe kèm version đang có lên requestTopic:
+ *   [0] protocol (1), [1] n, rồi n x {geohash 5 bytes, version u16 LE}
+ * Server trả mỗi tile một message trên responseTopic (FULL / DIFF /
+ * UNCHANGED, xem GeofenceTileStore). Task xong khi đủ n message hoặc
+ * timeout; không mandatory – geofence vẫn chạy trên dữ liệu cũ.
+ */
+class GeofenceTileSyncTask : public NetworkTask
+{
+public:
+    static const uint8_t PROTOCOL_VERSION = 1;
+    static const uint8_t MAX_TILES        = 4;
+
+    GeofenceTileSyncTask(GsmConfiguration &gsmRef,
+                         GeofenceTileStore &storeRef,
+                         const char *requestTopicIn,
+                         const char *responseTopicIn,
+                         const char tilesIn[][GEOHASH_TILE_LEN],
+                         uint8_t tileCountIn,
+                         bool &zonesChangedOut)
+        : gsm(gsmRef),
+          store(storeRef),
+          requestTopic(requestTopicIn),
+          responseTopic(responseTopicIn),
+          zonesChanged(zonesChangedOut)
+    {
+        tileCount = min(tileCountIn, MAX_TILES);
+        memcpy(tiles, tilesIn, tileCount * GEOHASH_TILE_LEN);
+    }
+
+    bool isMandatory() const override { return false; }
+
+    void execute() override
+    {
+        if (isCompleted())
+            return;
+
+        // 1) First tick: subscribe + publish request
+        if (!isStarted())
+        {
+            markStarted();
+
+            if (!gsm.mqttConnected() || tileCount == 0)
+            {
+                markCompleted();
+                return;
+            }
+
+            g_activeGeofenceSyncTask = this;
+
+            if (!gsm.mqtt.subscribe(responseTopic))
+            {
+                Serial.println(F("[GEOTILE] MQTT subscribe failed"));
+                finish();
+                return;
+            }
+
+            uint8_t buf[2 + MAX_TILES * (GEOHASH_TILE_LEN + 2)];
+            uint8_t len = 0;
+            buf[len++] = PROTOCOL_VERSION;
+            buf[len++] = tileCount;
+            for (uint8_t i = 0; i < tileCount; ++i)
+            {
+                uint16_t v = store.versionOf(tiles[i]);
+                memcpy(&buf[len], tiles[i], GEOHASH_TILE_LEN);
+                len += GEOHASH_TILE_LEN;
+                buf[len++] = v & 0xFF;
+                buf[len++] = v >> 8;
+            }
+
+            if (!gsm.publishMqtt(buf, len, requestTopic))
+            {
+                Serial.println(F("[GEOTILE] sync request publish FAILED"));
+                finish();
+                return;
+            }
+
+            Serial.print(F("[GEOTILE] sync request tiles="));
+            Serial.println(tileCount);
+            return;
+        }
+
+        // 2) Pump MQTT until every tile answered. Tile trước còn đang ghi
+        //    EEPROM (service() trong loop) → để message sau chờ trong modem
+        if (!store.busy())
+            gsm.stepMqtt();
+
+        if (responses >= tileCount)
+        {
+            finish();
+            return;
+        }
+
+        if (millis() - getStartMs() > timeoutMs)
+        {
+            Serial.print(F("[GEOTILE] sync timeout, responses="));
+            Serial.println(responses);
+            finish();
+        }
+    }
+
+    // Called from global MQTT callback when a message arrives
+    void onMqttMessage(const char *topic, const uint8_t *payload, unsigned int length)
+    {
+        if (isCompleted() || strcmp(topic, responseTopic) != 0)
+            return;
+
+        if (store.apply(payload, (uint16_t)length) == GeofenceTileStore::APPLY_UPDATED)
+            zonesChanged = true;
+        responses++;
+    }
+
+private:
+    GsmConfiguration &gsm;
+    GeofenceTileStore &store;
+    const char *requestTopic;  // e.g. "geofence/sync/BIK_298A1J35"
+    const char *responseTopic; // e.g. "geofence/tiles/BIK_298A1J35"
+    bool &zonesChanged;
+
+    char tiles[MAX_TILES][GEOHASH_TILE_LEN];
+    uint8_t tileCount = 0;
+    uint8_t responses = 0;
+    uint32_t timeoutMs = 15000;
+
+    void finish()
+    {
+        gsm.mqtt.unsubscribe(responseTopic);
+        if (g_activeGeofenceSyncTask == this)
+            g_activeGeofenceSyncTask = nullptr;
+        markCompleted();
+    }
+};
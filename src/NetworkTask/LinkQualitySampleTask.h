@@ -0,0 +1,90 @@
+#pragma once
+
+#include <Arduino.h>
+#include "NetworkTask.h"
+#include "NetworkConfiguration/GsmConfiguration.h"
+#include "NetworkConfiguration/LinkQualityMonitor.h"
+
+// Low-priority background sample: AT+CSQ, then AT+CPSI?
+// Kết quả được đẩy vào LinkQualityMonitor.
+class LinkQualitySampleTask : public NetworkTask
+{
+public:
+    explicit LinkQualitySampleTask(GsmConfiguration &gsmRef,
+                                   LinkQualityMonitor &monitorRef,
+                                   uint32_t timeoutMs = 3000)
+        : gsm(gsmRef),
+          monitor(monitorRef),
+          timeoutMs(timeoutMs)
+    {
+    }
+
+    // Nice-to-have, can be dropped if queue is full
+    bool isMandatory() const override { return false; }
+
+    void execute() override
+    {
+        if (isCompleted())
+            return;
+
+        // ----------------- FIRST CALL: send +CSQ -----------------
+        if (!isStarted())
+        {
+            markStarted();
+            phase = PHASE_CSQ;
+            sendCommand("+CSQ");
+            return;
+        }
+
+        // ----------------- SUBSEQUENT CALLS: read response -----------------
+        int8_t r = gsm.pollTaskResponse(resp);
+
+        if (r > 0)
+        {
+            if (phase == PHASE_CSQ)
+            {
+                if (r == 1)
+                    monitor.parseCsqLine(GsmConfiguration::responseLine(resp, "+CSQ:"));
+
+                // CSQ done → ask for RAT
+                phase = PHASE_CPSI;
+                sendCommand("+CPSI?");
+                return;
+            }
+
+            if (r == 1)
+                monitor.parseCpsiLine(GsmConfiguration::responseLine(resp, "+CPSI:"));
+            markCompleted();
+            return;
+        }
+
+        // ----------------- TIMEOUT CHECK -----------------
+        if (millis() - phaseStartMs > timeoutMs)
+        {
+            Serial.println(F("[LINK] sample timeout"));
+            markCompleted();
+        }
+    }
+
+private:
+    enum Phase : uint8_t
+    {
+        PHASE_CSQ,
+        PHASE_CPSI
+    };
+
+    GsmConfiguration &gsm;
+    LinkQualityMonitor &monitor;
+    uint32_t timeoutMs;
+
+    Phase phase = PHASE_CSQ;
+    uint32_t phaseStartMs = 0;
+    String resp;   // response đọc dần qua các lần execute()
+
+    void sendCommand(const char *cmd)
+    {
+        resp = "";
+        gsm.sendTaskAT(cmd);
+        phaseStartMs = millis();
+    }
+};
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Arduino.h>
+#include "NetworkTask.h"
+#include "NetworkConfiguration/GsmConfiguration.h"
+#include "GpsConfiguration/LocationProvider.h"
+
+// Low-priority poll of the SIM7600 GNSS: AT+CGPS=1 (once), then AT+CGPSINFO.
+// powerOff = true: AT+CGPS=0 khi NEO-M10 đã có fix ổn định (tiết kiệm
+// 40-60 mA của GNSS modem). Kết quả được đẩy vào ModemGnssLocationProvider.
+class ModemGnssPollTask : public NetworkTask
+{
+public:
+    explicit ModemGnssPollTask(GsmConfiguration &gsmRef,
+                               ModemGnssLocationProvider &providerRef,
+                               bool powerOff = false,
+                               uint32_t timeoutMs = 3000)
+        : gsm(gsmRef),
+          provider(providerRef),
+          powerOff(powerOff),
+          timeoutMs(timeoutMs)
+    {
+    }
+
+    // Nice-to-have, can be dropped if queue is full
+    bool isMandatory() const override { return false; }
+
+    void execute() override
+    {
+        if (isCompleted())
+            return;
+
+        // ----------------- FIRST CALL: power GNSS on/off or poll -----------------
+        if (!isStarted())
+        {
+            markStarted();
+            if (powerOff)
+            {
+                phase = PHASE_POWER_OFF;
+                sendCommand("+CGPS=0");
+            }
+            else if (!provider.powered)
+            {
+                phase = PHASE_POWER;
+                sendCommand("+CGPS=1");
+            }
+            else
+            {
+                phase = PHASE_INFO;
+                sendCommand("+CGPSINFO");
+            }
+            return;
+        }
+
+        // ----------------- SUBSEQUENT CALLS: read response -----------------
+        int8_t r = gsm.pollTaskResponse(resp);
+
+        if (r > 0)
+        {
+            if (phase == PHASE_INFO && r == 1)
+            {
+                provider.parseCgpsInfoLine(GsmConfiguration::responseLine(resp, "+CGPSINFO:"));
+            }
+            else if (phase == PHASE_POWER)
+            {
+                // ERROR ở đây thường là "đã bật rồi" → vẫn coi như bật
+                provider.powered = true;
+                Serial.println(F("[MGNSS] modem GNSS on"));
+            }
+            else if (phase == PHASE_POWER_OFF)
+            {
+                // ERROR = đã tắt sẵn → cũng coi như tắt
+                provider.onPowerOff();
+                Serial.println(F("[MGNSS] modem GNSS off (primary fix stable)"));
+            }
+            markCompleted();
+            return;
+        }
+
+        // ----------------- TIMEOUT CHECK -----------------
+        if (millis() - phaseStartMs > timeoutMs)
+        {
+            Serial.println(F("[MGNSS] poll timeout"));
+            markCompleted();
+        }
+    }
+
+private:
+    enum Phase : uint8_t
+    {
+        PHASE_POWER,
+        PHASE_INFO,
+        PHASE_POWER_OFF
+    };
+
+    GsmConfiguration &gsm;
+    ModemGnssLocationProvider &provider;
+    bool powerOff;
+    uint32_t timeoutMs;
+
+    Phase phase = PHASE_INFO;
+    uint32_t phaseStartMs = 0;
+    String resp;   // response đọc dần qua các lần execute()
+
+    void sendCommand(const char *cmd)
+    {
+        resp = "";
+        gsm.sendTaskAT(cmd);
+        phaseStartMs = millis();
+    }
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Arduino.h>
+#include "NetworkTask.h"
+#include "NetworkConfiguration/GsmConfiguration.h"
+#include "ImuConfiguration/CrashDetector.h"
+
+/**
+ * PublishCrashAlertTask
+ *
+ * Alert CRASH = [alert đã encode][trace len u16 LE][trace]. Chỉ copy phần
+ * alert (~150 B); trace stream thẳng từ traceBuf của CrashDetector qua
+ * beginPublish()/write() – detector giữ nguyên buffer tới khi task kết
+ * thúc (gửi xong, lỗi hay bị scheduler bỏ) rồi mới clearEvent().
+ */
+struct PublishCrashAlertTask : public NetworkTask
+{
+    GsmConfiguration &gsm;
+    CrashDetector &detector;
+    uint8_t *head;       // owned copy of encoded alert
+    size_t headLen;
+    const char *topic;   // MQTT topic (not owned)
+
+    PublishCrashAlertTask(GsmConfiguration &gsmRef,
+                          CrashDetector &detectorRef,
+                          const uint8_t *alert,
+                          size_t alertLen,
+                          const char *mqttTopic)
+        : gsm(gsmRef),
+          detector(detectorRef),
+          head(new uint8_t[alertLen]),
+          headLen(alertLen),
+          topic(mqttTopic)
+    {
+        if (head)
+            memcpy(head, alert, alertLen);
+        detector.markSending();
+    }
+
+    ~PublishCrashAlertTask() override
+    {
+        delete[] head;
+        detector.clearEvent();
+    }
+
+    void execute() override
+    {
+        if (isCompleted())
+            return;
+
+        markStarted();
+
+        if (!head || !gsm.mqttConnected())
+        {
+            Serial.println(head ? F("[CRASH] alert: MQTT not connected")
+                                : F("[CRASH] alert: out of memory"));
+            markCompleted();
+            return;
+        }
+
+        uint16_t traceLen = detector.traceLength();
+        uint8_t lenLE[2] = {(uint8_t)(traceLen & 0xFF), (uint8_t)(traceLen >> 8)};
+
+        bool ok = gsm.mqtt.beginPublish(topic, headLen + 2 + traceLen, false) &&
+                  gsm.mqtt.write(head, headLen) == headLen &&
+                  gsm.mqtt.write(lenLE, 2) == 2 &&
+                  gsm.mqtt.write(detector.trace(), traceLen) == traceLen &&
+                  gsm.mqtt.endPublish();
+
+        Serial.print(ok ? F("[CRASH] alert published, bytes=") : F("[CRASH] alert publish FAILED, bytes="));
+        Serial.println(headLen + 2 + traceLen);
+        markCompleted();
+    }
+};
@@ -24,7 +24,8 @@ struct PublishMqttTask : public NetworkTask
         if (payload && payloadLen > 0)
         {
             data = new uint8_t[payloadLen];
-            memcpy(data, payload, payloadLen);
+            if (data) // hết heap → execute() báo Empty payload
+                memcpy(data, payload, payloadLen);
         }
     }
 
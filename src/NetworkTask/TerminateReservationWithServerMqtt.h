@@ -7,6 +7,7 @@
 #include "Domains/Bike.h"
 #include "Domains/Trip.h"
 #include "UI/DisplayTask.h"
+#include "TripConfiguration/TripTrackRecorder.h"
 
 // Forward declaration so global callback can see it
 class TerminateReservationWithServerMqtt;
@@ -24,6 +25,8 @@ private:
     DisplayPage &currentDisplayedPage;
     DisplayPage &prevDisplayedPage;
     bool &toUpdateDisplay;
+    const char *trackTopic;          // e.g. "/reservation/BIK_298A1J35/<trip>/track"
+    const TripTrackRecorder *track;  // polyline chuyến đi (nullable)
 
     bool awaitingResponse = false;
     bool responseReceived = false;
@@ -42,8 +45,9 @@ public:
                                    UsageState &bikeStateOut,
                                    DisplayPage &currentDisplayedPage,
                                    DisplayPage &prevDisplayedPage,
-                                   bool &toUpdateDisplayOut
-
+                                   bool &toUpdateDisplayOut,
+                                   const char *trackTopicIn = nullptr,
+                                   const TripTrackRecorder *trackIn = nullptr
                                    )
         : gsm(gsmRef),
           tripTerminationPayload(tripIn),
@@ -53,7 +57,9 @@ public:
           bikeStateRef(bikeStateOut),
           currentDisplayedPage(currentDisplayedPage),
           prevDisplayedPage(prevDisplayedPage),
-          toUpdateDisplay(toUpdateDisplayOut)
+          toUpdateDisplay(toUpdateDisplayOut),
+          trackTopic(trackTopicIn),
+          track(trackIn)
 
     {
     }
@@ -95,6 +101,9 @@ public:
             Serial.print(F("[TRIP] Subscribed to: "));
             Serial.println(responseTopic);
 
+            // Track polyline trước request termination (lỗi không chặn termination)
+            publishTrack();
+
             // Encode Trip → binary
             uint8_t buffer[256];
             int len = encodeTripTerminationPayload(tripTerminationPayload, buffer);
@@ -193,6 +202,21 @@ public:
     }
 
 private:
+    // Track có thể lớn hơn buffer PubSubClient → publish dạng stream
+    void publishTrack()
+    {
+        if (!trackTopic || !track || !track->hasTrack())
+            return;
+
+        uint16_t len = track->length();
+        bool ok = gsm.mqtt.beginPublish(trackTopic, len, false) &&
+                  gsm.mqtt.write(track->data(), len) == len &&
+                  gsm.mqtt.endPublish();
+
+        Serial.print(ok ? F("[TRIP] Track published, bytes=") : F("[TRIP] Track publish FAILED, bytes="));
+        Serial.println(len);
+    }
+
     void finishFromResponse()
     {
         Serial.println(F("[TRIP] finishFromResponse()"));
@@ -83,23 +83,19 @@ public:
             return;
         }
 
-        // 3) HTTP đã xong (OK hoặc ERROR)
-        String resp = http.getHttpResult();
-        bool ok = http.isHttpOk();
+        // 3) HTTP đã xong (OK hoặc ERROR) – parser đã tách header, chỉ còn body
+        bool ok = http.isHttpOk() && http.getHttpBodyLength() > 0;
+        String jsonPart = ok ? String(http.getHttpBody()) : String();
 
         http.resetHttp(); // giải phóng HTTP layer cho task khác
 
-        if (!ok || resp.length() == 0)
+        if (!ok)
         {
             Serial.println(F("[TRIP] HTTP error or empty response"));
             markCompleted();
             return;
         }
 
-        // 4) Tách header khỏi body
-        int headerEnd = resp.indexOf("\r\n\r\n");
-        String jsonPart = (headerEnd >= 0) ? resp.substring(headerEnd + 4) : resp;
-
         Serial.println(F("[TRIP] Raw JSON from server:"));
         Serial.println(jsonPart);
 
@@ -0,0 +1,199 @@
+#pragma once
+#include <Arduino.h>
+#include <avr/sleep.h>
+#include <avr/power.h>
+#include "ImuConfiguration/ImuConfiguraton.h"
+
+/**
+ * ParkGuard
+ *
+ * Xe đỗ (IDLE, không chuyến, hàng đợi mạng rỗng):
+ *   - PARKED_AWAKE: PARK_ENTER_MS đầu loop() vẫn chạy hết tốc độ → đo
+ *     dòng nền (INA219) để so sánh
+ *   - PARKED_SLEEP: MPU sang motion-wake khi yên PARK_QUIET_MS; giữa các
+ *     vòng loop() MCU ngủ SLEEP_MODE_IDLE, chỉ chạy tiếp khi có ngắt MOT /
+ *     đủ lô IMU, byte UART (modem, debug, Dabble, QR; GPS khi ring đầy
+ *     nửa) hoặc hết TICK_MS. Idle (không phải power-down) vì USART phải
+ *     còn clock để nhận byte ở 115200 và Timer0 giữ millis().
+ *   - chống trộm: chỉ arm sau PARK_ENTER_MS liên tục không chuyển động
+ *     kể từ lúc đỗ (người lái dắt / dựng xe sau chuyến không tính). Mỗi
+ *     giây ghi 1 bit "có chuyển động"; ≥ THEFT_ACTIVE_S giây trong
+ *     THEFT_WINDOW_S giây gần nhất → theftPending (1 lần, arm lại sau một
+ *     cửa sổ yên PARK_ENTER_MS nữa).
+ */
+class ParkGuard
+{
+public:
+    static const uint32_t PARK_ENTER_MS  = 30000UL;
+    static const uint32_t PARK_QUIET_MS  = 10000UL;
+    static const uint16_t TICK_MS        = 1000;
+    static const uint8_t  THEFT_WINDOW_S = 15;
+    static const uint8_t  THEFT_ACTIVE_S = 8;
+
+    enum State : uint8_t
+    {
+        ACTIVE = 0,
+        PARKED_AWAKE,
+        PARKED_SLEEP
+    };
+
+    // ---------------- Stats ----------------
+    uint32_t sleepMs = 0;
+    uint32_t wakeups = 0;        // thức vì có việc (không tính tick Timer0)
+    uint32_t theftAlerts = 0;
+
+    explicit ParkGuard(ImuConfiguration &imuRef) : imu(imuRef) {}
+
+    State state() const { return st; }
+    bool canSleep() const { return st == PARKED_SLEEP; }
+    bool theftIsArmed() const { return theftArmed; }
+    bool hasTheftEvent() const { return theftPending; }
+    void clearTheftEvent() { theftPending = false; }
+
+    // Mỗi vòng loop(); currentMa = dòng INA219 mới nhất
+    void update(unsigned long now, bool parked, float currentMa)
+    {
+        if (!parked)
+        {
+            if (st != ACTIVE)
+            {
+                st = ACTIVE;
+                imu.exitMotionWake();
+                Serial.println(F("[PARK] active"));
+            }
+            motionBits = 0;
+            theftArmed = false;
+            return;
+        }
+
+        if (st == ACTIVE)
+        {
+            st = PARKED_AWAKE;
+            parkedSinceMs = now;
+            lastTickMs = now;
+        }
+
+        if (st == PARKED_AWAKE)
+        {
+            awakeMaSum += currentMa;
+            awakeMaCount++;
+            if (now - parkedSinceMs >= PARK_ENTER_MS)
+            {
+                st = PARKED_SLEEP;
+                Serial.println(F("[PARK] sleep enabled"));
+            }
+        }
+        else
+        {
+            sleepMaSum += currentMa;
+            sleepMaCount++;
+
+            if (!imu.motionWake && now - imu.lastMotionMs >= PARK_QUIET_MS)
+                imu.enterMotionWake();
+        }
+
+        if (now - lastTickMs >= TICK_MS)
+        {
+            lastTickMs = now;
+            tickTheft(now);
+        }
+    }
+
+    // -------------------------------------------------
+    // Ngủ tới khi wakePending() hoặc hết TICK_MS. Kiểm tra điều kiện với
+    // ngắt tắt rồi "sei; sleep" (AVR chạy lệnh sau sei trước khi vào ISR)
+    // → không lỡ ngắt tới ngay trước khi ngủ.
+    // -------------------------------------------------
+    void sleep(bool (*wakePending)())
+    {
+        unsigned long start = millis();
+
+        uint8_t adcsra = ADCSRA;
+        ADCSRA &= ~_BV(ADEN);
+        power_adc_disable();
+        set_sleep_mode(SLEEP_MODE_IDLE);
+
+        while (millis() - start < TICK_MS)
+        {
+            cli();
+            if (wakePending())
+            {
+                sei();
+                wakeups++;
+                break;
+            }
+            sleep_enable();
+            sei();
+            sleep_cpu();
+            sleep_disable();
+        }
+
+        power_adc_enable();
+        ADCSRA = adcsra;
+        sleepMs += millis() - start;
+    }
+
+    void printStats()
+    {
+        float awake = awakeMaCount ? awakeMaSum / awakeMaCount : 0;
+        float asleep = sleepMaCount ? sleepMaSum / sleepMaCount : 0;
+
+        Serial.print(F("[PARK] state="));
+        Serial.print(st);
+        Serial.print(F(" idle mA awake="));
+        Serial.print(awake, 1);
+        Serial.print(F(" sleep="));
+        Serial.print(asleep, 1);
+        Serial.print(F(" saved="));
+        Serial.print(awakeMaCount && sleepMaCount ? awake - asleep : 0, 1);
+        Serial.print(F(" sleep(s)="));
+        Serial.print(sleepMs / 1000UL);
+        Serial.print(F(" wakeups="));
+        Serial.print(wakeups);
+        Serial.print(F(" theft="));
+        Serial.println(theftAlerts);
+    }
+
+private:
+    ImuConfiguration &imu;
+    State st = ACTIVE;
+    unsigned long parkedSinceMs = 0;
+    unsigned long lastTickMs = 0;
+
+    uint16_t motionBits = 0;     // bit0 = giây gần nhất
+    bool theftArmed = false;     // arm sau cửa sổ yên (quietFor)
+    bool theftPending = false;
+
+    float awakeMaSum = 0, sleepMaSum = 0;
+    uint32_t awakeMaCount = 0, sleepMaCount = 0;
+
+    void tickTheft(unsigned long now)
+    {
+        bool moving = now - imu.lastMotionMs < TICK_MS;
+        motionBits = (uint16_t)((motionBits << 1) | (moving ? 1 : 0)) & ((1U << THEFT_WINDOW_S) - 1);
+
+        uint8_t active = 0;
+        for (uint16_t b = motionBits; b; b &= b - 1)
+            active++;
+
+        if (theftArmed && active >= THEFT_ACTIVE_S)
+        {
+            theftArmed = false;
+            theftPending = true;
+            theftAlerts++;
+            Serial.print(F("[PARK] sustained motion without trip, active(s)="));
+            Serial.println(active);
+        }
+        else if (!theftArmed && quietFor(now, PARK_ENTER_MS))
+        {
+            theftArmed = true;
+            Serial.println(F("[PARK] theft armed"));
+        }
+    }
+
+    // Đã đỗ và không chuyển động liên tục ít nhất ms
+    bool quietFor(unsigned long now, uint32_t ms) const
+    {
+        return now - parkedSinceMs >= ms && now - imu.lastMotionMs >= ms;
+    }
+};
@@ -0,0 +1,367 @@
+#pragma once
+#include <Arduino.h>
+#include <util/atomic.h>
+
+#ifndef sbi
+#define sbi(sfr, bit) (_SFR_BYTE(sfr) |= _BV(bit))
+#endif
+#ifndef cbi
+#define cbi(sfr, bit) (_SFR_BYTE(sfr) &= ~_BV(bit))
+#endif
+
+// -----------------------------------------------------------
+// Kích thước ring theo từng cổng (override bằng -D trong platformio.ini)
+//   UART1 = NEO-M10 (38400)       → RX 256
+//   UART2 = SIM7600 (115200+)     → RX 512
+// -----------------------------------------------------------
+#ifndef UART1_RX_BUFFER_SIZE
+#define UART1_RX_BUFFER_SIZE 256
+#endif
+#ifndef UART1_TX_BUFFER_SIZE
+#define UART1_TX_BUFFER_SIZE 64
+#endif
+#ifndef UART2_RX_BUFFER_SIZE
+#define UART2_RX_BUFFER_SIZE 512
+#endif
+#ifndef UART2_TX_BUFFER_SIZE
+#define UART2_TX_BUFFER_SIZE 128
+#endif
+
+/**
+ * BufferedUart
+ *
+ * Thay cho HardwareSerial của core trên USART1 / USART2:
+ *   - ring RX / TX kích thước riêng từng cổng (core: 64 B cố định)
+ *   - ISR đọc UCSRnA trước UDRn → đếm data overrun (DOR), framing (FE),
+ *     parity (UPE) mà core bỏ qua
+ *   - đếm byte bị bỏ vì ring đầy + high-water mark để chứng minh
+ *     không mất byte khi loop() bị kẹt (sendBuffer, MQTT connect…)
+ *
+ * LƯU Ý: file này định nghĩa ISR(USART1_*) / ISR(USART2_*). Không được
+ * dùng Serial1 / Serial2 của core ở bất kỳ đâu (link sẽ trùng vector).
+ * Serial3 vẫn thuộc core vì Dabble gắn cứng với nó.
+ */
+class BufferedUart : public Stream
+{
+public:
+    // ---------------- Stats (ghi trong ISR) ----------------
+    volatile uint32_t rxBytes       = 0;
+    volatile uint32_t rxDropped     = 0; // ring đầy
+    volatile uint32_t overruns      = 0; // DOR: ISR tới trễ, byte mất trong HW
+    volatile uint32_t framingErrors = 0; // FE: thường là lệch baud
+    volatile uint32_t parityErrors  = 0;
+    volatile uint16_t rxHighWater   = 0;
+
+    BufferedUart(volatile uint8_t *ubrrh, volatile uint8_t *ubrrl,
+                 volatile uint8_t *ucsra, volatile uint8_t *ucsrb,
+                 volatile uint8_t *ucsrc, volatile uint8_t *udr,
+                 uint8_t *rxBuf, uint16_t rxSize,
+                 uint8_t *txBuf, uint16_t txSize)
+        : _ubrrh(ubrrh), _ubrrl(ubrrl), _ucsra(ucsra), _ucsrb(ucsrb),
+          _ucsrc(ucsrc), _udr(udr),
+          _rxBuf(rxBuf), _rxSize(rxSize), _txBuf(txBuf), _txSize(txSize) {}
+
+    // Cùng công thức baud với HardwareSerial::begin (U2X trừ 57600 @16MHz)
+    void begin(unsigned long baud, uint8_t config = SERIAL_8N1)
+    {
+        uint16_t setting = (F_CPU / 4 / baud - 1) / 2;
+        *_ucsra = 1 << U2X0;
+
+        if (((F_CPU == 16000000UL) && (baud == 57600)) || (setting > 4095))
+        {
+            *_ucsra = 0;
+            setting = (F_CPU / 8 / baud - 1) / 2;
+        }
+
+        *_ubrrh = setting >> 8;
+        *_ubrrl = setting;
+
+        _written = false;
+        *_ucsrc = config;
+
+        sbi(*_ucsrb, RXEN0);
+        sbi(*_ucsrb, TXEN0);
+        sbi(*_ucsrb, RXCIE0);
+        cbi(*_ucsrb, UDRIE0);
+    }
+
+    void end()
+    {
+        flush();
+        cbi(*_ucsrb, RXEN0);
+        cbi(*_ucsrb, TXEN0);
+        cbi(*_ucsrb, RXCIE0);
+        cbi(*_ucsrb, UDRIE0);
+        _rxTail = rxHeadAtomic();
+    }
+
+    // ---------------- Stream ----------------
+    int available() override
+    {
+        return used(rxHeadAtomic(), _rxTail, _rxSize);
+    }
+
+    int peek() override
+    {
+        if (rxHeadAtomic() == _rxTail)
+            return -1;
+        return _rxBuf[_rxTail];
+    }
+
+    int read() override
+    {
+        if (rxHeadAtomic() == _rxTail)
+            return -1;
+
+        uint8_t c = _rxBuf[_rxTail];
+        uint16_t next = _rxTail + 1;
+        if (next == _rxSize)
+            next = 0;
+        _rxTail = next; // chỉ main ghi tail → không cần atomic với ISR RX
+        return c;
+    }
+
+    int availableForWrite() override
+    {
+        uint16_t head, tail;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            head = _txHead;
+            tail = _txTail;
+        }
+        return _txSize - 1 - used(head, tail, _txSize);
+    }
+
+    void flush() override
+    {
+        if (!_written)
+            return;
+
+        while (bit_is_set(*_ucsrb, UDRIE0) || bit_is_clear(*_ucsra, TXC0))
+        {
+            // interrupt đang tắt → tự bơm TX
+            if (bit_is_clear(SREG, SREG_I) && bit_is_set(*_ucsrb, UDRIE0))
+                if (bit_is_set(*_ucsra, UDRE0))
+                    udreIrq();
+        }
+    }
+
+    size_t write(uint8_t c) override
+    {
+        _written = true;
+
+        // ring trống + UDR rảnh → ghi thẳng, đỡ một lần ISR
+        if (_txHead == _txTail && bit_is_set(*_ucsra, UDRE0))
+        {
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+            {
+                *_udr = c;
+                *_ucsra = ((*_ucsra) & ((1 << U2X0) | (1 << MPCM0))) | (1 << TXC0);
+            }
+            return 1;
+        }
+
+        uint16_t next = _txHead + 1;
+        if (next == _txSize)
+            next = 0;
+
+        // ring TX đầy → chờ ISR rút bớt
+        while (next == _txTail)
+        {
+            if (bit_is_clear(SREG, SREG_I))
+            {
+                if (bit_is_set(*_ucsra, UDRE0))
+                    udreIrq();
+            }
+        }
+
+        _txBuf[_txHead] = c;
+
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            _txHead = next;
+            sbi(*_ucsrb, UDRIE0);
+        }
+        return 1;
+    }
+
+    using Print::write;
+
+    operator bool() { return true; }
+
+    // ---------------- ISR hooks ----------------
+    inline void rxIrq()
+    {
+        // đọc cờ lỗi TRƯỚC khi đọc UDR (đọc UDR sẽ xoá cờ)
+        uint8_t status = *_ucsra;
+        uint8_t c = *_udr;
+
+        if (status & (1 << DOR0))
+            overruns++;
+        if (status & (1 << FE0))
+            framingErrors++;
+        if (status & (1 << UPE0))
+        {
+            parityErrors++;
+            return; // giống core: bỏ byte lỗi parity
+        }
+
+        uint16_t next = _rxHead + 1;
+        if (next == _rxSize)
+            next = 0;
+
+        if (next == _rxTail)
+        {
+            rxDropped++;
+            return;
+        }
+
+        _rxBuf[_rxHead] = c;
+        _rxHead = next;
+        rxBytes++;
+
+        uint16_t fill = used(next, _rxTail, _rxSize);
+        if (fill > rxHighWater)
+            rxHighWater = fill;
+    }
+
+    inline void udreIrq()
+    {
+        uint8_t c = _txBuf[_txTail];
+        uint16_t next = _txTail + 1;
+        if (next == _txSize)
+            next = 0;
+        _txTail = next;
+
+        *_udr = c;
+        *_ucsra = ((*_ucsra) & ((1 << U2X0) | (1 << MPCM0))) | (1 << TXC0);
+
+        if (_txHead == _txTail)
+            cbi(*_ucsrb, UDRIE0);
+    }
+
+    // ---------------- Diagnostics ----------------
+    uint16_t rxCapacity() const { return _rxSize - 1; }
+
+    // tổng byte mất (HW overrun + ring đầy)
+    uint32_t lostBytes()
+    {
+        uint32_t n;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            n = overruns + rxDropped;
+        }
+        return n;
+    }
+
+    uint32_t framingErrorCount()
+    {
+        uint32_t n;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            n = framingErrors;
+        }
+        return n;
+    }
+
+    void printStats(const __FlashStringHelper *name)
+    {
+        uint32_t rx, drop, ovr, fe, pe;
+        uint16_t hw;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            rx = rxBytes;
+            drop = rxDropped;
+            ovr = overruns;
+            fe = framingErrors;
+            pe = parityErrors;
+            hw = rxHighWater;
+        }
+
+        Serial.print(F("[UART] "));
+        Serial.print(name);
+        Serial.print(F(" rx="));
+        Serial.print(rx);
+        Serial.print(F(" highWater="));
+        Serial.print(hw);
+        Serial.print('/');
+        Serial.print(rxCapacity());
+        Serial.print(F(" dropped="));
+        Serial.print(drop);
+        Serial.print(F(" overrun="));
+        Serial.print(ovr);
+        Serial.print(F(" framing="));
+        Serial.print(fe);
+        Serial.print(F(" parity="));
+        Serial.println(pe);
+    }
+
+    void resetStats()
+    {
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            rxBytes = 0;
+            rxDropped = 0;
+            overruns = 0;
+            framingErrors = 0;
+            parityErrors = 0;
+            rxHighWater = 0;
+        }
+    }
+
+private:
+    volatile uint8_t *const _ubrrh;
+    volatile uint8_t *const _ubrrl;
+    volatile uint8_t *const _ucsra;
+    volatile uint8_t *const _ucsrb;
+    volatile uint8_t *const _ucsrc;
+    volatile uint8_t *const _udr;
+
+    uint8_t *const _rxBuf;
+    const uint16_t _rxSize;
+    uint8_t *const _txBuf;
+    const uint16_t _txSize;
+
+    volatile uint16_t _rxHead = 0; // ghi trong ISR
+    volatile uint16_t _rxTail = 0; // ghi trong main
+    volatile uint16_t _txHead = 0; // ghi trong main
+    volatile uint16_t _txTail = 0; // ghi trong ISR
+    bool _written = false;
+
+    // head/tail 16-bit: đọc nguyên tử vì ISR có thể ghi giữa 2 byte
+    uint16_t rxHeadAtomic() const
+    {
+        uint16_t h;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+        {
+            h = _rxHead;
+        }
+        return h;
+    }
+
+    static uint16_t used(uint16_t head, uint16_t tail, uint16_t size)
+    {
+        return (head >= tail) ? (head - tail) : (uint16_t)(size - tail + head);
+    }
+};
+
+// ===========================================================
+//  Instances + ISR (USART1 = GPS, USART2 = modem)
+// ===========================================================
+static uint8_t uart1RxBuf[UART1_RX_BUFFER_SIZE];
+static uint8_t uart1TxBuf[UART1_TX_BUFFER_SIZE];
+static uint8_t uart2RxBuf[UART2_RX_BUFFER_SIZE];
+static uint8_t uart2TxBuf[UART2_TX_BUFFER_SIZE];
+
+BufferedUart Uart1(&UBRR1H, &UBRR1L, &UCSR1A, &UCSR1B, &UCSR1C, &UDR1,
+                   uart1RxBuf, UART1_RX_BUFFER_SIZE,
+                   uart1TxBuf, UART1_TX_BUFFER_SIZE);
+
+BufferedUart Uart2(&UBRR2H, &UBRR2L, &UCSR2A, &UCSR2B, &UCSR2C, &UDR2,
+                   uart2RxBuf, UART2_RX_BUFFER_SIZE,
+                   uart2TxBuf, UART2_TX_BUFFER_SIZE);
+
+ISR(USART1_RX_vect) { Uart1.rxIrq(); }
+ISR(USART1_UDRE_vect) { Uart1.udreIrq(); }
+ISR(USART2_RX_vect) { Uart2.rxIrq(); }
+ISR(USART2_UDRE_vect) { Uart2.udreIrq(); }
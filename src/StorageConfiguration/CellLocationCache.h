@@ -0,0 +1,324 @@
+#pragma once
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "StorageConfiguration/EepromLayout.h"
+#include "StorageConfiguration/EepromJournal.h"
+#include "Domains/CellInfo.h"
+
+// -----------------------------------------------------------
+// Một entry trong EEPROM (32 bytes)
+// -----------------------------------------------------------
+struct CellLocationEntry
+{
+    uint16_t mcc;        // 0 = slot trống
+    uint16_t mnc;
+    uint32_t lac;
+    uint32_t cid;
+    float    lat;
+    float    lon;
+    uint16_t accuracyM;  // accuracy do UnwiredLabs trả về
+    uint8_t  confidence; // 0..100, suy ra từ accuracy
+    uint8_t  reserved;
+    uint32_t storedAtS;  // unix seconds lúc lưu (0 = chưa có giờ)
+    uint16_t lruStamp;   // stamp lúc lưu / refresh (khôi phục thứ tự LRU khi boot)
+    uint16_t reserved2;
+};
+
+/**
+ * CellLocationCache
+ *
+ * Cache LRU nhỏ (mcc, mnc, lac, cid) → (lat, lon) trong EEPROM để xe
+ * đứng trong nhà không gọi UnwiredLabs lặp lại cho cùng một cell.
+ *
+ * - Entry đọc thẳng từ EEPROM khi lookup; chỉ giữ stamp LRU trong RAM.
+ * - Hit chỉ cập nhật RAM → không ghi EEPROM; chỉ store() mới ghi
+ *   (EEPROM.put bỏ qua byte không đổi).
+ * - lookup() trả MISS / STALE / HIT; caller chỉ enqueue
+ *   QueryGeolocationApiTask khi không phải HIT.
+ */
+struct CellLocationCache
+{
+    static const uint8_t  ENTRY_COUNT = 8;
+    static const uint16_t MAGIC       = 0xCE11;
+    static const uint8_t  VERSION     = 1;
+
+    // Cell tower không đổi vị trí; refresh định kỳ để bắt cell bị re-plan
+    static const uint32_t MAX_AGE_S          = 30UL * 24UL * 3600UL;
+    // Entry độ tin cậy thấp → refresh sớm hơn
+    static const uint32_t LOW_CONF_MAX_AGE_S = 3UL * 24UL * 3600UL;
+    static const uint8_t  LOW_CONFIDENCE     = 50;
+
+    enum Result : uint8_t
+    {
+        MISS,
+        STALE,
+        HIT
+    };
+
+    uint16_t lruStamps[ENTRY_COUNT] = {0}; // 0 = slot trống
+    uint16_t lruClock = 0;
+
+    // ---------------- Stats ----------------
+    uint32_t lookups     = 0;
+    uint32_t hits        = 0;
+    uint32_t staleHits   = 0;
+    uint32_t misses      = 0;
+    uint32_t stores      = 0;
+    uint32_t evictions   = 0;
+
+    // -------------------------------------------------
+    // Đọc header + khôi phục stamp LRU từ EEPROM
+    // -------------------------------------------------
+    void begin()
+    {
+        EepromLock lock;
+        uint16_t magic;
+        uint8_t version;
+        EEPROM.get(EEPROM_CELL_CACHE_ADDR, magic);
+        EEPROM.get(EEPROM_CELL_CACHE_ADDR + sizeof(uint16_t), version);
+
+        if (magic != MAGIC || version != VERSION)
+        {
+            Serial.println(F("[CELLCACHE] no valid cache, formatting"));
+            clear();
+            return;
+        }
+
+        lruClock = 0;
+        uint8_t used = 0;
+        for (uint8_t i = 0; i < ENTRY_COUNT; ++i)
+        {
+            CellLocationEntry e;
+            readEntry(i, e);
+            lruStamps[i] = (e.mcc == 0) ? 0 : (e.lruStamp ? e.lruStamp : 1);
+            if (lruStamps[i] > lruClock)
+                lruClock = lruStamps[i];
+            if (e.mcc != 0)
+                used++;
+        }
+
+        Serial.print(F("[CELLCACHE] loaded entries="));
+        Serial.println(used);
+    }
+
+    void clear()
+    {
+        CellLocationEntry empty;
+        memset(&empty, 0, sizeof(empty));
+        for (uint8_t i = 0; i < ENTRY_COUNT; ++i)
+        {
+            writeEntry(i, empty);
+            lruStamps[i] = 0;
+        }
+        lruClock = 0;
+
+        // EEPROM.put lấy tham chiếu → chép ra biến (static const không có định nghĩa)
+        uint16_t magic = MAGIC;
+        uint8_t version = VERSION;
+        EepromLock lock;
+        EEPROM.put(EEPROM_CELL_CACHE_ADDR, magic);
+        EEPROM.put(EEPROM_CELL_CACHE_ADDR + sizeof(uint16_t), version);
+    }
+
+    // -------------------------------------------------
+    // Lookup: HIT → outLat/outLon được ghi
+    // STALE → vẫn ghi toạ độ cũ (dùng tạm) nhưng nên refresh
+    // nowS = unix seconds hiện tại (0 nếu chưa sync giờ)
+    // -------------------------------------------------
+    Result lookup(const CellInfo &cell, uint32_t nowS, float &outLat, float &outLon)
+    {
+        lookups++;
+
+        CellLocationEntry e;
+        int8_t slot = findSlot(cell, e);
+        if (slot < 0)
+        {
+            misses++;
+            return MISS;
+        }
+
+        outLat = e.lat;
+        outLon = e.lon;
+        touch(slot);
+
+        if (isStale(e, nowS))
+        {
+            staleHits++;
+            return STALE;
+        }
+
+        hits++;
+        return HIT;
+    }
+
+    // -------------------------------------------------
+    // Lưu kết quả UnwiredLabs (refresh nếu đã có, không thì
+    // dùng slot trống hoặc đẩy entry ít dùng nhất ra)
+    // -------------------------------------------------
+    void store(const CellInfo &cell, float lat, float lon, uint16_t accuracyM, uint32_t nowS)
+    {
+        if (cell.mcc <= 0 || cell.lac <= 0 || cell.cid <= 0)
+            return;
+
+        CellLocationEntry e;
+        int8_t slot = findSlot(cell, e);
+        if (slot < 0)
+            slot = victimSlot();
+
+        e.mcc        = (uint16_t)cell.mcc;
+        e.mnc        = (uint16_t)cell.mnc;
+        e.lac        = (uint32_t)cell.lac;
+        e.cid        = (uint32_t)cell.cid;
+        e.lat        = lat;
+        e.lon        = lon;
+        e.accuracyM  = accuracyM;
+        e.confidence = confidenceFromAccuracy(accuracyM);
+        e.reserved   = 0;
+        e.storedAtS  = nowS;
+        touch(slot);
+        e.lruStamp   = lruStamps[slot];
+        e.reserved2  = 0;
+
+        writeEntry(slot, e);
+        stores++;
+    }
+
+    // ===================================================
+    //  Diagnostics
+    // ===================================================
+
+    uint8_t hitRatePercent() const
+    {
+        if (lookups == 0)
+            return 0;
+        return (uint8_t)(hits * 100UL / lookups);
+    }
+
+    // mỗi HIT = một HTTP POST (có trả phí) không phải gửi
+    uint32_t apiCallsAvoided() const { return hits; }
+
+    void printStats()
+    {
+        Serial.print(F("[CELLCACHE] lookups="));
+        Serial.print(lookups);
+        Serial.print(F(" hits="));
+        Serial.print(hits);
+        Serial.print(F(" stale="));
+        Serial.print(staleHits);
+        Serial.print(F(" misses="));
+        Serial.print(misses);
+        Serial.print(F(" hitRate="));
+        Serial.print(hitRatePercent());
+        Serial.print(F("% apiAvoided="));
+        Serial.print(apiCallsAvoided());
+        Serial.print(F(" stores="));
+        Serial.print(stores);
+        Serial.print(F(" evictions="));
+        Serial.println(evictions);
+    }
+
+private:
+    static int entryAddr(uint8_t slot)
+    {
+        return EEPROM_CELL_CACHE_ADDR + 4 + slot * (int)sizeof(CellLocationEntry);
+    }
+
+    static void readEntry(uint8_t slot, CellLocationEntry &e)
+    {
+        EepromLock lock;
+        EEPROM.get(entryAddr(slot), e);
+    }
+
+    static void writeEntry(uint8_t slot, const CellLocationEntry &e)
+    {
+        EepromLock lock;
+        EEPROM.put(entryAddr(slot), e);
+    }
+
+    static bool sameCell(const CellLocationEntry &e, const CellInfo &cell)
+    {
+        return e.mcc == (uint16_t)cell.mcc &&
+               e.mnc == (uint16_t)cell.mnc &&
+               e.lac == (uint32_t)cell.lac &&
+               e.cid == (uint32_t)cell.cid;
+    }
+
+    int8_t findSlot(const CellInfo &cell, CellLocationEntry &out)
+    {
+        for (uint8_t i = 0; i < ENTRY_COUNT; ++i)
+        {
+            if (lruStamps[i] == 0)
+                continue;
+            readEntry(i, out);
+            if (sameCell(out, cell))
+                return i;
+        }
+        return -1;
+    }
+
+    // Slot trống trước, không thì entry có stamp nhỏ nhất
+    int8_t victimSlot()
+    {
+        int8_t victim = 0;
+        for (uint8_t i = 0; i < ENTRY_COUNT; ++i)
+        {
+            if (lruStamps[i] == 0)
+                return i;
+            if (lruStamps[i] < lruStamps[victim])
+                victim = i;
+        }
+        evictions++;
+        return victim;
+    }
+
+    void touch(uint8_t slot)
+    {
+        if (lruClock == 0xFFFF)
+            renumber();
+        lruStamps[slot] = ++lruClock;
+    }
+
+    // Clock sắp tràn → đánh số lại 1..n giữ nguyên thứ tự
+    void renumber()
+    {
+        uint16_t next = 1;
+        for (uint8_t rank = 0; rank < ENTRY_COUNT; ++rank)
+        {
+            int8_t best = -1;
+            for (uint8_t i = 0; i < ENTRY_COUNT; ++i)
+            {
+                if (lruStamps[i] < next)
+                    continue; // trống hoặc đã đánh số
+                if (best < 0 || lruStamps[i] < lruStamps[best])
+                    best = i;
+            }
+            if (best < 0)
+                break;
+            lruStamps[best] = next++;
+        }
+        lruClock = next - 1;
+    }
+
+    static bool isStale(const CellLocationEntry &e, uint32_t nowS)
+    {
+        // chưa có giờ (hoặc entry lưu lúc chưa có giờ) → vẫn dùng được
+        if (nowS == 0 || e.storedAtS == 0 || nowS < e.storedAtS)
+            return false;
+
+        uint32_t ageS = nowS - e.storedAtS;
+        uint32_t maxAgeS = (e.confidence < LOW_CONFIDENCE) ? LOW_CONF_MAX_AGE_S : MAX_AGE_S;
+        return ageS > maxAgeS;
+    }
+
+    // ≤100 m → 100, 2 km+ → 0 (tuyến tính ở giữa)
+    static uint8_t confidenceFromAccuracy(uint16_t accuracyM)
+    {
+        if (accuracyM == 0)
+            return LOW_CONFIDENCE; // server không trả accuracy
+        if (accuracyM <= 100)
+            return 100;
+        if (accuracyM >= 2000)
+            return 0;
+        return (uint8_t)(100UL - (uint32_t)(accuracyM - 100) * 100UL / 1900UL);
+    }
+};
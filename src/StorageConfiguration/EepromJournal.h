@@ -0,0 +1,280 @@
+#pragma once
+#include <Arduino.h>
+#include <avr/interrupt.h>
+#include <util/crc16.h>
+
+// -----------------------------------------------------------
+// EepromJournal – log record cỡ cố định, xoay vòng trên 1 vùng EEPROM
+//
+// Record: [seq u16 LE][payload][crc u16 LE], CRC-16 (_crc_ccitt_update,
+// init 0xFFFF) trên seq + payload. Record n ghi vào slot n % slots, seq
+// tăng 1 mỗi lần → mỗi ô EEPROM chỉ bị ghi 1 lần / `slots` lần lưu.
+//
+// Ghi không chặn: append() chép record vào RAM rồi bật EERIE; ISR
+// EE_READY ghi từng byte (bỏ qua byte không đổi), mỗi byte ~3.4 ms chạy
+// nền. Chỉ 1 record đang ghi tại 1 thời điểm (append() trả false khi bận).
+//
+// Boot: slot i thuộc vòng hiện tại ⇔ seq(i) == seq(0) + i → tìm nhị phân
+// slot mới nhất (log2(slots) lần đọc seq), kiểm CRC; record ghi dở (mất
+// điện) → lùi 1 slot, vẫn hỏng → quét toàn bộ.
+//
+// LƯU Ý: file này định nghĩa ISR(EE_READY_vect). Module khác đọc/ghi
+// EEPROM (EEPROM.get/put/read/write) phải giữ EepromLock trong lúc truy
+// cập, nếu không ISR có thể chen giữa lúc set EEAR và EERE/EEPE.
+// -----------------------------------------------------------
+
+/**
+ * EepromLock
+ *
+ * Tạm dừng journal (tắt EERIE) và chờ byte đang ghi xong (tối đa
+ * ~3.4 ms, chỉ khi đúng lúc journal đang ghi). Lồng nhau được; lock
+ * lồng trong lock khác không phải chờ (journal đã dừng sẵn).
+ *
+ * pause() / release(): dạng không RAII cho khoá trải qua nhiều lời gọi
+ * (giữ giá trị pause() trả về, đưa lại cho release()).
+ */
+class EepromLock
+{
+public:
+    EepromLock() : resume(pause()) {}
+
+    ~EepromLock() { release(resume); }
+
+    static bool pause()
+    {
+        bool r = EECR & _BV(EERIE);
+        EECR &= ~_BV(EERIE);
+        while (EECR & _BV(EEPE)) {}
+        return r;
+    }
+
+    static void release(bool resume)
+    {
+        if (resume)
+            EECR |= _BV(EERIE);
+    }
+
+private:
+    bool resume;
+};
+
+class EepromJournal
+{
+public:
+    static const uint8_t MAX_PAYLOAD = 16;
+    static const uint8_t OVERHEAD    = 4;   // seq + crc
+
+    // ---------------- Stats ----------------
+    uint32_t appends      = 0;
+    uint32_t busySkips    = 0;   // append() khi record trước chưa ghi xong
+    uint32_t bytesWritten = 0;   // byte thực ghi (đã bỏ byte không đổi)
+    uint8_t  bootReads    = 0;   // số record đọc seq / CRC lúc begin()
+    bool     bootFullScan = false;
+
+    EepromJournal(int baseAddr, uint8_t slotCount, uint8_t payloadSize)
+        : base(baseAddr), slots(slotCount), payloadLen(payloadSize),
+          recLen(payloadSize + OVERHEAD) {}
+
+    static int regionSize(uint8_t slotCount, uint8_t payloadSize)
+    {
+        return (int)slotCount * (payloadSize + OVERHEAD);
+    }
+
+    // Tìm record mới nhất; true + chép payload vào out nếu có
+    bool begin(void *out)
+    {
+        bootReads = 0;
+        bootFullScan = false;
+
+        int16_t newest = findNewest();
+        if (newest < 0)
+        {
+            nextSlot = 0;
+            nextSeq = 0;
+            return false;
+        }
+
+        nextSlot = (uint8_t)((newest + 1) % slots);
+        nextSeq = readSeq((uint8_t)newest) + 1;
+        for (uint8_t i = 0; i < payloadLen; ++i)
+            ((uint8_t *)out)[i] = eeRead(slotAddr((uint8_t)newest) + 2 + i);
+        return true;
+    }
+
+    bool busy() const { return writing; }
+
+    // Không chặn; false nếu record trước còn đang ghi
+    bool append(const void *payload)
+    {
+        if (writing)
+        {
+            busySkips++;
+            return false;
+        }
+
+        wbuf[0] = (uint8_t)(nextSeq & 0xFF);
+        wbuf[1] = (uint8_t)(nextSeq >> 8);
+        memcpy(wbuf + 2, payload, payloadLen);
+        uint16_t crc = crcBuffer(wbuf, payloadLen + 2);
+        wbuf[payloadLen + 2] = (uint8_t)(crc & 0xFF);
+        wbuf[payloadLen + 3] = (uint8_t)(crc >> 8);
+
+        waddr = slotAddr(nextSlot);
+        wpos = 0;
+        nextSlot = (uint8_t)((nextSlot + 1) % slots);
+        nextSeq++;
+        appends++;
+
+        writing = true;
+        active = this;
+        EECR |= _BV(EERIE);   // ISR chạy ngay khi EEPE = 0
+        return true;
+    }
+
+    // Gọi từ ISR(EE_READY_vect): ghi byte kế tiếp hoặc kết thúc record
+    void readyIrq()
+    {
+        while (wpos < recLen)
+        {
+            uint16_t addr = (uint16_t)(waddr + wpos);
+            uint8_t b = wbuf[wpos++];
+
+            EEAR = addr;
+            EECR |= _BV(EERE);
+            if (EEDR == b)
+                continue;
+
+            EEDR = b;
+            EECR |= _BV(EEMPE);
+            EECR |= _BV(EEPE);
+            bytesWritten++;
+            return;
+        }
+
+        EECR &= ~_BV(EERIE);
+        writing = false;
+        active = nullptr;
+    }
+
+    void printStats(const __FlashStringHelper *name)
+    {
+        Serial.print(F("[EEJ] "));
+        Serial.print(name);
+        Serial.print(F(" appends="));
+        Serial.print(appends);
+        Serial.print(F(" busy="));
+        Serial.print(busySkips);
+        Serial.print(F(" bytes="));
+        Serial.print(bytesWritten);
+        Serial.print(F(" nextSlot="));
+        Serial.print(nextSlot);
+        Serial.print(F("/"));
+        Serial.print(slots);
+        Serial.print(F(" bootReads="));
+        Serial.print(bootReads);
+        Serial.println(bootFullScan ? F(" (full scan)") : F(""));
+    }
+
+    static EepromJournal *volatile active;
+
+private:
+    const int base;
+    const uint8_t slots;
+    const uint8_t payloadLen;
+    const uint8_t recLen;
+
+    uint8_t nextSlot = 0;
+    uint16_t nextSeq = 0;
+
+    // ghi nền (ISR)
+    uint8_t wbuf[MAX_PAYLOAD + OVERHEAD];
+    int waddr = 0;
+    volatile uint8_t wpos = 0;
+    volatile bool writing = false;
+
+    int slotAddr(uint8_t i) const { return base + (int)i * recLen; }
+
+    static uint8_t eeRead(int addr)
+    {
+        while (EECR & _BV(EEPE)) {}
+        EEAR = (uint16_t)addr;
+        EECR |= _BV(EERE);
+        return EEDR;
+    }
+
+    uint16_t readSeq(uint8_t i)
+    {
+        bootReads++;
+        int a = slotAddr(i);
+        return (uint16_t)(eeRead(a) | ((uint16_t)eeRead(a + 1) << 8));
+    }
+
+    bool valid(uint8_t i)
+    {
+        int a = slotAddr(i);
+        uint16_t crc = 0xFFFF;
+        for (uint8_t k = 0; k < payloadLen + 2; ++k)
+            crc = _crc_ccitt_update(crc, eeRead(a + k));
+        uint16_t stored = (uint16_t)(eeRead(a + payloadLen + 2) | ((uint16_t)eeRead(a + payloadLen + 3) << 8));
+        return crc == stored;
+    }
+
+    int16_t findNewest()
+    {
+        // slot cuối cùng còn nối tiếp seq(0)
+        uint16_t seq0 = readSeq(0);
+        uint8_t lo = 0, hi = slots - 1;
+        while (lo < hi)
+        {
+            uint8_t mid = (uint8_t)((lo + hi + 1) / 2);
+            if ((uint16_t)(readSeq(mid) - seq0) == mid)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+
+        if (valid(lo))
+            return lo;
+
+        // record mới nhất ghi dở → record trước nó
+        uint8_t prev = (uint8_t)((lo + slots - 1) % slots);
+        if (valid(prev) && (uint16_t)(readSeq(lo) - readSeq(prev)) == 1)
+            return prev;
+
+        // hỏng ngoài dự kiến (hoặc vùng trống) → quét toàn bộ
+        bootFullScan = true;
+        int16_t best = -1;
+        uint16_t bestSeq = 0;
+        for (uint8_t i = 0; i < slots; ++i)
+        {
+            if (!valid(i))
+                continue;
+            uint16_t s = readSeq(i);
+            if (best < 0 || (int16_t)(s - bestSeq) > 0)
+            {
+                best = i;
+                bestSeq = s;
+            }
+        }
+        return best;
+    }
+
+    static uint16_t crcBuffer(const uint8_t *p, uint8_t n)
+    {
+        uint16_t crc = 0xFFFF;
+        for (uint8_t i = 0; i < n; ++i)
+            crc = _crc_ccitt_update(crc, p[i]);
+        return crc;
+    }
+};
+
+EepromJournal *volatile EepromJournal::active = nullptr;
+
+ISR(EE_READY_vect)
+{
+    EepromJournal *j = EepromJournal::active;
+    if (j)
+        j->readyIrq();
+    else
+        EECR &= ~_BV(EERIE);
+}
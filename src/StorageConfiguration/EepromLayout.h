@@ -0,0 +1,37 @@
+#pragma once
+#include <Arduino.h>
+
+// -----------------------------------------------------------
+// EEPROM layout (ATmega2560: 4096 bytes)
+//
+// Mỗi module tự quản lý nội dung vùng của mình, file này chỉ
+// giữ địa chỉ để các vùng không chồng lên nhau.
+// -----------------------------------------------------------
+
+// 0..15 : BatteryStateManager bản cũ (magic + highestV + mAhUsed), chỉ còn
+//         đọc 1 lần khi journal trống để chuyển sang journal
+static const int EEPROM_BATTERY_ADDR = 0;
+static const int EEPROM_BATTERY_SIZE = 16;
+
+// 16..31 : GsmConfiguration – rate modem bản cũ dò được, chỉ còn đọc 1 lần
+//          lúc boot để đưa modem về 115200
+static const int EEPROM_MODEM_BAUD_ADDR = EEPROM_BATTERY_ADDR + EEPROM_BATTERY_SIZE;
+static const int EEPROM_MODEM_BAUD_SIZE = 16;
+
+// 32..291 : CellLocationCache – header (magic + version) + 8 x 32-byte entries
+static const int EEPROM_CELL_CACHE_ADDR = EEPROM_MODEM_BAUD_ADDR + EEPROM_MODEM_BAUD_SIZE;
+static const int EEPROM_CELL_CACHE_SIZE = 4 + 8 * 32;
+
+// 292..323 : MotionEngine – lifetime odometer, 4 x 8-byte slots (xoay vòng)
+static const int EEPROM_ODOMETER_ADDR = EEPROM_CELL_CACHE_ADDR + EEPROM_CELL_CACHE_SIZE;
+static const int EEPROM_ODOMETER_SIZE = 4 * 8;
+
+// 324..1859 : GeofenceTileStore – 6 x 256-byte tile slots (header 16 + data 240)
+static const int EEPROM_GEO_TILE_ADDR = EEPROM_ODOMETER_ADDR + EEPROM_ODOMETER_SIZE;
+static const int EEPROM_GEO_TILE_SIZE = 6 * 256;
+
+// 1860..2627 : BatteryStateManager – EepromJournal 64 x 12-byte record
+//              (seq + highestV + uAhUsed + CRC), xoay vòng
+static const int EEPROM_BATTERY_JOURNAL_ADDR  = EEPROM_GEO_TILE_ADDR + EEPROM_GEO_TILE_SIZE;
+static const uint8_t EEPROM_BATTERY_JOURNAL_SLOTS = 64;
+static const int EEPROM_BATTERY_JOURNAL_SIZE  = EEPROM_BATTERY_JOURNAL_SLOTS * 12;
@@ -0,0 +1,69 @@
+#pragma once
+#include <Arduino.h>
+
+// Ký hiệu của linker / avr-libc malloc
+extern char __data_start;
+extern char __heap_start;
+extern char *__brkval;
+
+/**
+ * MemoryMonitor
+ *
+ * Đo SRAM trên máy thật thay vì ước lượng:
+ *   - static = .data + .bss (RAMSTART → __heap_start), khớp số "RAM" của pio run
+ *   - heap   = __heap_start → __brkval (đỉnh malloc/new hiện tại)
+ *   - free   = khoảng trống heap ↔ SP lúc gọi
+ *   - low-water: begin() tô vùng trống bằng PAINT lúc boot; printStats()
+ *     quét từ đỉnh heap lên tới byte đầu tiên bị ghi → khoảng trống nhỏ
+ *     nhất heap ↔ stack từng có (stack sâu nhất, kể cả trong ISR)
+ *
+ * Gọi begin() ở dòng đầu setup(). Quét tối đa vài KB, ~1 ms / 60 s.
+ */
+class MemoryMonitor
+{
+public:
+    static const uint8_t PAINT = 0xC5;
+    static const uint8_t GUARD = 32;   // chừa khung stack của begin()
+
+    void begin()
+    {
+        uint8_t *p = heapEnd();
+        uint8_t *top = (uint8_t *)SP - GUARD;
+        while (p < top)
+            *p++ = PAINT;
+    }
+
+    uint16_t staticBytes() const { return (uint16_t)(&__heap_start - &__data_start); }
+
+    uint16_t heapBytes() const { return (uint16_t)(heapEnd() - (uint8_t *)&__heap_start); }
+
+    uint16_t freeNow() const { return (uint16_t)((uint8_t *)SP - heapEnd()); }
+
+    // Khoảng trống nhỏ nhất heap ↔ stack kể từ begin()
+    uint16_t lowWater() const
+    {
+        uint8_t *p = heapEnd();
+        uint8_t *sp = (uint8_t *)SP;
+        while (p < sp && *p == PAINT)
+            ++p;
+        return (uint16_t)(p - heapEnd());
+    }
+
+    void printStats()
+    {
+        Serial.print(F("[MEM] static="));
+        Serial.print(staticBytes());
+        Serial.print(F(" heap="));
+        Serial.print(heapBytes());
+        Serial.print(F(" free="));
+        Serial.print(freeNow());
+        Serial.print(F(" lowWater="));
+        Serial.println(lowWater());
+    }
+
+private:
+    static uint8_t *heapEnd()
+    {
+        return (uint8_t *)(__brkval ? __brkval : &__heap_start);
+    }
+};
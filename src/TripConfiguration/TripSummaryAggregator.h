@@ -0,0 +1,135 @@
+#pragma once
+#include <Arduino.h>
+#include "Domains/Alert.h"
+#include "Domains/Trip.h"
+
+/**
+ * TripSummaryAggregator
+ *
+ * Cộng dồn số liệu chuyến đi ngay trên xe (O(1) bộ nhớ) từ lúc tháo
+ * helmet tới lúc cắm lại: quãng đường (MotionEngine), thời gian chạy,
+ * tốc độ max / trung bình, mAh tiêu thụ (coulomb counter của
+ * BatteryStateManager), số alert theo loại. Kết quả đi kèm termination
+ * (TripTerminationPayload v1) → backend không phải dựng lại từ
+ * telemetry, có thể giảm tần suất telemetry giữa chuyến.
+ */
+class TripSummaryAggregator
+{
+public:
+    static const int32_t  MOVING_MM_S = 833;  // > 3 km/h = đang chạy
+    static const uint16_t MAX_STEP_MS = 2000; // mất GPS lâu → không cộng cả khoảng
+
+    void start(uint32_t nowMs, float mAhUsedNow)
+    {
+        memset(&sum, 0, sizeof(sum));
+        startMs = nowMs;
+        lastMotionMs = nowMs;
+        movingMs = 0;
+        lastMah = mAhUsedNow;
+        energyMah = 0;
+        maxSpeedMmS = 0;
+        active = true;
+    }
+
+    bool isActive() const { return active; }
+
+    // mỗi fix GPS (sau MotionEngine::onGpsFix)
+    void onMotion(uint32_t tripMeters, int32_t speedMmS, uint32_t nowMs)
+    {
+        if (!active)
+            return;
+
+        uint32_t dt = nowMs - lastMotionMs;
+        lastMotionMs = nowMs;
+        if (dt > MAX_STEP_MS)
+            dt = MAX_STEP_MS;
+
+        if (speedMmS >= MOVING_MM_S)
+            movingMs += dt;
+        if (speedMmS > maxSpeedMmS)
+            maxSpeedMmS = speedMmS;
+
+        sum.distance_m = tripMeters;
+    }
+
+    // mỗi lần BatteryStateManager::update(); chỉ cộng phần tăng
+    // (giảm = đang sạc / reset theo điện áp → bỏ qua)
+    void onBattery(float mAhUsedNow)
+    {
+        if (!active)
+            return;
+        if (mAhUsedNow > lastMah)
+            energyMah += mAhUsedNow - lastMah;
+        lastMah = mAhUsedNow;
+    }
+
+    void onAlert(AlertType type)
+    {
+        if (!active)
+            return;
+
+        uint8_t *counter = nullptr;
+        switch (type)
+        {
+        case AlertType::TOPPLE:         counter = &sum.topple_alerts; break;
+        case AlertType::CRASH:          counter = &sum.crash_alerts; break;
+        case AlertType::LOW_BATTERY:    counter = &sum.low_battery_alerts; break;
+        case AlertType::BOUNDARY_CROSS: counter = &sum.boundary_alerts; break;
+        case AlertType::THEFT:          break; // chỉ xảy ra khi không có chuyến
+        }
+        if (counter && *counter < 255)
+            (*counter)++;
+    }
+
+    // Chốt chuyến, điền summary cho termination payload
+    void finish(uint32_t nowMs, TripSummary &out)
+    {
+        if (active)
+        {
+            active = false;
+            sum.duration_s = (nowMs - startMs) / 1000UL;
+            sum.moving_s = movingMs / 1000UL;
+            sum.max_speed_kmh_x10 = (uint16_t)min((uint32_t)maxSpeedMmS * 36UL / 1000UL, (uint32_t)UINT16_MAX);
+            sum.avg_speed_kmh_x10 = movingMs
+                                        ? (uint16_t)min((uint64_t)sum.distance_m * 36000ULL / movingMs, (uint64_t)UINT16_MAX)
+                                        : 0;
+            sum.energy_mah = (uint16_t)min(energyMah + 0.5f, 65535.0f);
+            printStats();
+        }
+        out = sum;
+    }
+
+    void printStats()
+    {
+        Serial.print(F("[TRIPSUM] dist(m)="));
+        Serial.print(sum.distance_m);
+        Serial.print(F(" dur(s)="));
+        Serial.print(sum.duration_s);
+        Serial.print(F(" moving(s)="));
+        Serial.print(sum.moving_s);
+        Serial.print(F(" max(km/h x10)="));
+        Serial.print(sum.max_speed_kmh_x10);
+        Serial.print(F(" avg(km/h x10)="));
+        Serial.print(sum.avg_speed_kmh_x10);
+        Serial.print(F(" mAh="));
+        Serial.print(sum.energy_mah);
+        Serial.print(F(" alerts t/c/b/g="));
+        Serial.print(sum.topple_alerts);
+        Serial.print('/');
+        Serial.print(sum.crash_alerts);
+        Serial.print('/');
+        Serial.print(sum.low_battery_alerts);
+        Serial.print('/');
+        Serial.println(sum.boundary_alerts);
+    }
+
+private:
+    TripSummary sum;
+    bool active = false;
+    uint32_t startMs = 0;
+    uint32_t lastMotionMs = 0;
+    uint32_t movingMs = 0;
+    int32_t maxSpeedMmS = 0;
+    float lastMah = 0;
+    float energyMah = 0;
+};
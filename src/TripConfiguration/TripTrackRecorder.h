@@ -0,0 +1,432 @@
+#pragma once
+#include <Arduino.h>
+#include "MotionConfiguration/MotionEngine.h"
+
+#ifndef TRACK_BUFFER_BYTES
+#define TRACK_BUFFER_BYTES 384
+#endif
+
+// -----------------------------------------------------------
+// Polyline nhị phân (gửi lên server cùng termination):
+//   [0] FORMAT_VERSION
+//   điểm đầu : zigzag-varint lat, zigzag-varint lon, varint t
+//   điểm sau : zigzag-varint dLat, zigzag-varint dLon, varint dt
+// lat/lon đơn vị 1e-5 độ (~1.1 m, cùng độ chính xác polyline Google),
+// t = giây kể từ đầu chuyến. Thường ~4–5 byte / điểm.
+// -----------------------------------------------------------
+struct TrackPoint
+{
+    int32_t  lat5;
+    int32_t  lon5;
+    uint16_t tS;
+};
+
+class TrackPolylineWriter
+{
+public:
+    TrackPolylineWriter(uint8_t *buf, uint16_t cap, uint16_t pos) : buf(buf), cap(cap), len(pos) {}
+
+    // false nếu không đủ chỗ (không ghi gì)
+    bool append(const TrackPoint &p)
+    {
+        uint8_t tmp[15];
+        uint8_t n = 0;
+        if (count == 0)
+        {
+            n += putVarint(&tmp[n], zigzag(p.lat5));
+            n += putVarint(&tmp[n], zigzag(p.lon5));
+            n += putVarint(&tmp[n], p.tS);
+        }
+        else
+        {
+            n += putVarint(&tmp[n], zigzag(p.lat5 - prev.lat5));
+            n += putVarint(&tmp[n], zigzag(p.lon5 - prev.lon5));
+            n += putVarint(&tmp[n], (uint16_t)(p.tS - prev.tS));
+        }
+
+        if (len + n > cap)
+            return false;
+
+        memcpy(&buf[len], tmp, n);
+        len += n;
+        prev = p;
+        count++;
+        return true;
+    }
+
+    uint16_t length() const { return len; }
+    uint16_t points() const { return count; }
+
+private:
+    uint8_t *buf;
+    uint16_t cap;
+    uint16_t len;
+    uint16_t count = 0;
+    TrackPoint prev = {0, 0, 0};
+
+    static uint32_t zigzag(int32_t v) { return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31); }
+
+    static uint8_t putVarint(uint8_t *out, uint32_t v)
+    {
+        uint8_t n = 0;
+        while (v >= 0x80)
+        {
+            out[n++] = (uint8_t)(v | 0x80);
+            v >>= 7;
+        }
+        out[n++] = (uint8_t)v;
+        return n;
+    }
+};
+
+class TrackPolylineReader
+{
+public:
+    TrackPolylineReader(const uint8_t *buf, uint16_t len, uint16_t pos) : buf(buf), len(len), pos(pos) {}
+
+    bool next(TrackPoint &p)
+    {
+        uint32_t a, b, c;
+        if (!getVarint(a) || !getVarint(b) || !getVarint(c))
+            return false;
+
+        int32_t dLat = unzigzag(a), dLon = unzigzag(b);
+        if (first)
+        {
+            cur.lat5 = dLat;
+            cur.lon5 = dLon;
+            cur.tS = (uint16_t)c;
+            first = false;
+        }
+        else
+        {
+            cur.lat5 += dLat;
+            cur.lon5 += dLon;
+            cur.tS += (uint16_t)c;
+        }
+        p = cur;
+        return true;
+    }
+
+    uint16_t position() const { return pos; }
+
+private:
+    const uint8_t *buf;
+    uint16_t len;
+    uint16_t pos;
+    bool first = true;
+    TrackPoint cur = {0, 0, 0};
+
+    static int32_t unzigzag(uint32_t v) { return (int32_t)(v >> 1) ^ -(int32_t)(v & 1); }
+
+    bool getVarint(uint32_t &v)
+    {
+        v = 0;
+        for (uint8_t shift = 0; shift < 35; shift += 7)
+        {
+            if (pos >= len)
+                return false;
+            uint8_t b = buf[pos++];
+            v |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80))
+                return true;
+        }
+        return false;
+    }
+};
+
+// -----------------------------------------------------------
+// Đơn giản hoá online (opening window): giữ anchor + cửa sổ các điểm
+// chưa quyết; điểm mới P được nhận nếu mọi điểm trong cửa sổ cách đoạn
+// anchor→P ≤ tolerance. Không thì điểm cuối cửa sổ được phát ra làm
+// anchor mới. Khoảng cách tới đoạn (không phải đường thẳng) → quay đầu
+// giữa đường vẫn được giữ.
+// -----------------------------------------------------------
+class TrackSimplifier
+{
+public:
+    static const uint8_t WINDOW    = 24;
+    static const int32_t MAX_SPAN  = 20000; // ~22 km: ngoài khoảng này phát luôn (tránh tràn int32)
+
+    void reset(uint16_t toleranceUnits, uint16_t cosLatQ15)
+    {
+        tol = toleranceUnits;
+        cosQ15 = cosLatQ15;
+        hasAnchor = false;
+        winCount = 0;
+    }
+
+    // true nếu có điểm được phát ra (out)
+    bool push(const TrackPoint &p, TrackPoint &out)
+    {
+        if (!hasAnchor)
+        {
+            anchor = p;
+            hasAnchor = true;
+            out = p;
+            return true;
+        }
+
+        if (winCount < WINDOW && fits(p))
+        {
+            window[winCount++] = p;
+            return false;
+        }
+
+        // cửa sổ rỗng mà P đã quá MAX_SPAN (mất fix lâu / nhảy xa)
+        // → P thành anchor mới, phát luôn
+        if (winCount == 0)
+        {
+            anchor = p;
+            out = p;
+            return true;
+        }
+
+        // điểm cuối cửa sổ thành anchor mới, P mở cửa sổ mới
+        out = window[winCount - 1];
+        anchor = out;
+        window[0] = p;
+        winCount = 1;
+        return true;
+    }
+
+    bool flush(TrackPoint &out)
+    {
+        if (winCount == 0)
+            return false;
+        out = window[winCount - 1];
+        anchor = out;
+        winCount = 0;
+        return true;
+    }
+
+    uint16_t tolerance() const { return tol; }
+    void setTolerance(uint16_t t) { tol = t; }
+
+private:
+    uint16_t tol = 4;
+    uint16_t cosQ15 = 32768;
+    bool hasAnchor = false;
+    TrackPoint anchor;
+    TrackPoint window[WINDOW];
+    uint8_t winCount = 0;
+
+    int32_t dxOf(const TrackPoint &a, const TrackPoint &b) const
+    {
+        return (int32_t)(((int64_t)(b.lon5 - a.lon5) * cosQ15) >> 15);
+    }
+
+    bool fits(const TrackPoint &p) const
+    {
+        int32_t abx = dxOf(anchor, p), aby = p.lat5 - anchor.lat5;
+        if (abs(abx) > MAX_SPAN || abs(aby) > MAX_SPAN)
+            return false;
+
+        int32_t len2 = abx * abx + aby * aby;
+        int32_t limit = (int32_t)tol * (int32_t)isqrt32((uint32_t)len2);
+        int32_t tol2 = (int32_t)tol * tol;
+
+        for (uint8_t i = 0; i < winCount; ++i)
+        {
+            int32_t aqx = dxOf(anchor, window[i]), aqy = window[i].lat5 - anchor.lat5;
+            if (abs(aqx) > MAX_SPAN || abs(aqy) > MAX_SPAN)
+                return false;
+
+            int32_t dot = aqx * abx + aqy * aby;
+            if (dot <= 0 || len2 == 0)
+            {
+                if (aqx * aqx + aqy * aqy > tol2)
+                    return false;
+            }
+            else if (dot >= len2)
+            {
+                int32_t bqx = aqx - abx, bqy = aqy - aby;
+                if (bqx * bqx + bqy * bqy > tol2)
+                    return false;
+            }
+            else
+            {
+                int32_t cross = aqx * aby - aqy * abx;
+                if (abs(cross) > limit)
+                    return false;
+            }
+        }
+        return true;
+    }
+};
+
+/**
+ * TripTrackRecorder
+ *
+ * Ghi track chuyến đi khi usageState == INUSED: lấy mẫu GPS 1 Hz, lọc
+ * bán kính (đứng yên / nhiễu), đơn giản hoá online rồi mã hoá polyline
+ * delta-varint vào buffer RAM cố định TRACK_BUFFER_BYTES. Buffer đầy →
+ * nhân đôi tolerance và đơn giản hoá lại ngay trong buffer (delta gộp
+ * không bao giờ dài hơn tổng các delta cũ → ghi không đè phần chưa đọc).
+ *
+ * Upload một lần cùng TerminateReservationWithServerMqtt.
+ */
+class TripTrackRecorder
+{
+public:
+    static const uint8_t  FORMAT_VERSION     = 1;
+    static const uint16_t SAMPLE_INTERVAL_MS = 1000;
+    static const uint16_t BASE_TOLERANCE     = 4; // 1e-5 độ ≈ 4.4 m
+    static const uint16_t MIN_MOVE           = 3; // lọc bán kính ≈ 3.3 m
+
+    // ---------------- Stats ----------------
+    uint32_t samples       = 0;
+    uint32_t radialDropped = 0;
+    uint16_t recompactions = 0;
+    uint16_t overflowDrops = 0;
+
+    void start(uint32_t nowMs)
+    {
+        startMs = nowMs;
+        lastSampleMs = 0;
+        hasSample = false;
+        recording = true;
+        finished = false;
+        samples = radialDropped = 0;
+        recompactions = overflowDrops = 0;
+
+        buf[0] = FORMAT_VERSION;
+        writer = TrackPolylineWriter(buf, TRACK_BUFFER_BYTES, 1);
+        simplifier.reset(BASE_TOLERANCE, 32768);
+        cosReady = false;
+    }
+
+    void onFix(int32_t latE7, int32_t lonE7, uint32_t nowMs)
+    {
+        if (!recording)
+            return;
+        if (hasSample && nowMs - lastSampleMs < SAMPLE_INTERVAL_MS)
+            return;
+        lastSampleMs = nowMs;
+
+        TrackPoint p;
+        p.lat5 = roundE7To5(latE7);
+        p.lon5 = roundE7To5(lonE7);
+        uint32_t tS = (nowMs - startMs) / 1000UL;
+        p.tS = (uint16_t)min(tS, (uint32_t)UINT16_MAX);
+
+        if (!cosReady)
+        {
+            cosQ15 = (uint16_t)(cos(radians(latE7 * 1e-7f)) * 32767.0f);
+            simplifier.reset(BASE_TOLERANCE, cosQ15);
+            cosReady = true;
+        }
+
+        samples++;
+
+        // lọc bán kính so với mẫu nhận trước đó
+        if (hasSample && abs(p.lat5 - lastKept.lat5) < MIN_MOVE &&
+            abs(p.lon5 - lastKept.lon5) < MIN_MOVE)
+        {
+            radialDropped++;
+            return;
+        }
+        hasSample = true;
+        lastKept = p;
+
+        TrackPoint out;
+        if (simplifier.push(p, out))
+            emit(out);
+    }
+
+    // Kết thúc chuyến: phát điểm cuối còn trong cửa sổ
+    void finish()
+    {
+        if (!recording)
+            return;
+        recording = false;
+        finished = true;
+
+        TrackPoint out;
+        if (simplifier.flush(out))
+            emit(out);
+
+        printStats();
+    }
+
+    bool hasTrack() const { return finished && writer.points() > 0; }
+    const uint8_t *data() const { return buf; }
+    uint16_t length() const { return writer.length(); }
+
+    void printStats()
+    {
+        Serial.print(F("[TRACK] samples="));
+        Serial.print(samples);
+        Serial.print(F(" radialDrop="));
+        Serial.print(radialDropped);
+        Serial.print(F(" points="));
+        Serial.print(writer.points());
+        Serial.print(F(" bytes="));
+        Serial.print(writer.length());
+        Serial.print('/');
+        Serial.print(TRACK_BUFFER_BYTES);
+        Serial.print(F(" tol="));
+        Serial.print(simplifier.tolerance());
+        Serial.print(F(" recompact="));
+        Serial.print(recompactions);
+        Serial.print(F(" overflow="));
+        Serial.println(overflowDrops);
+    }
+
+private:
+    uint8_t buf[TRACK_BUFFER_BYTES];
+    TrackPolylineWriter writer = TrackPolylineWriter(buf, TRACK_BUFFER_BYTES, 1);
+    TrackSimplifier simplifier;
+
+    uint32_t startMs = 0;
+    uint32_t lastSampleMs = 0;
+    bool hasSample = false;
+    bool recording = false;
+    bool finished = false;
+    bool cosReady = false;
+    uint16_t cosQ15 = 32767;
+    TrackPoint lastKept;
+
+    static int32_t roundE7To5(int32_t v)
+    {
+        return (v >= 0) ? (v + 50) / 100 : (v - 50) / 100;
+    }
+
+    void emit(const TrackPoint &p)
+    {
+        if (writer.append(p))
+            return;
+
+        // đầy: thô hơn gấp đôi, tối đa vài lần rồi bỏ điểm
+        for (uint8_t attempt = 0; attempt < 3; ++attempt)
+        {
+            recompact();
+            if (writer.append(p))
+                return;
+        }
+        overflowDrops++;
+    }
+
+    // Đơn giản hoá lại polyline trong buffer với tolerance x2
+    void recompact()
+    {
+        uint16_t newTol = simplifier.tolerance() * 2;
+        recompactions++;
+
+        TrackSimplifier pass;
+        pass.reset(newTol, cosQ15);
+        TrackPolylineReader reader(buf, writer.length(), 1);
+        TrackPolylineWriter out(buf, TRACK_BUFFER_BYTES, 1);
+
+        TrackPoint p, e;
+        while (reader.next(p))
+            if (pass.push(p, e))
+                out.append(e);
+        if (pass.flush(e))
+            out.append(e);
+
+        // điểm cuối giữ nguyên → luồng chính nối tiếp được, chỉ đổi tolerance
+        writer = out;
+        simplifier.setTolerance(newTol);
+    }
+};
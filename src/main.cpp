@@ -5,6 +5,7 @@
 #include <PubSubClient.h>
 #include <TinyGPSPlus.h>
 #include <HardwareSerial.h>
+#include "SerialConfiguration/BufferedUart.h"
 #include <time.h>
 #include <SoftwareSerial.h>
 #include <Dabble.h>
@@ -17,21 +18,36 @@
 #include "GpsConfiguration/GpsConfiguration.h"
 #include "NetworkConfiguration/GsmConfiguration.h"
 #include "NetworkConfiguration/HttpConfiguration.h"
+#include "NetworkConfiguration/BufferedClient.h"
 #include "TimeConfiguration/TimeConfiguration.h"
 #include "QrScannerConfiguration/QrScannerUtilityNonBlocking.h"
 
 // Scheduler + Tasks
 #include "NetworkConfiguration/NetworkQueue.h"
 #include "NetworkTask/PublishMqttTask.h"
+#include "NetworkTask/PublishCrashAlertTask.h"
 #include "NetworkTask/CellTowerQueryTask.h"
 #include "NetworkTask/FetchGeolocationApiTask.h"
+#include "NetworkTask/ModemGnssPollTask.h"
+#include "GpsConfiguration/LocationProvider.h"
+#include "MotionConfiguration/MotionEngine.h"
+#include "TripConfiguration/TripTrackRecorder.h"
+#include "TripConfiguration/TripSummaryAggregator.h"
+#include "GeofenceConfiguration/GeofenceEngine.h"
+#include "GeofenceConfiguration/GeofenceTileStore.h"
+#include "NetworkTask/GeofenceTileSyncTask.h"
+#include "StorageConfiguration/CellLocationCache.h"
 #include "NetworkTask/ValidateReservationWithServer.h"
 #include "NetworkTask/HttpMaintenanceTask.h"
 #include "NetworkTask/MqttMaintenanceTask.h"
 #include "NetworkTask/ValidateReservationWithServerMqtt.h"
 #include "NetworkTask/TerminateReservationWithServerMqtt.h"
+#include "NetworkTask/LinkQualitySampleTask.h"
+#include "NetworkConfiguration/LinkQualityMonitor.h"
 #include "BatteryManagement/BatteryStateManager.h"
 #include "ImuConfiguration/ImuConfiguraton.h"
+#include "PowerConfiguration/ParkGuard.h"
+#include "SystemConfiguration/MemoryMonitor.h"
 
 #include <Wire.h>
 #include <U8g2lib.h>
@@ -57,8 +73,13 @@ SoftwareSerial qrSerial(A14, A15);
 
 Adafruit_INA219 ina219;
 
-// GPS trên Serial1 (NEO-M10)
-GpsConfiguration gpsConfiguration(&Serial1);
+// GPS trên USART1 (NEO-M10) – UBX NAV-PVT 5 Hz, tự lùi về NMEA nếu không ACK
+GpsConfiguration gpsConfiguration(&Uart1, GpsMode::UBX_PVT, 5);
+
+// Nguồn vị trí: NEO-M10 (chính) + GNSS của SIM7600 (phụ)
+NeoGpsLocationProvider neoLocation(gpsConfiguration);
+ModemGnssLocationProvider modemLocation;
+LocationArbiter locationArbiter;
 
 const String bikeUserName = "BIK_298A1J35";
 const String bikePassworkd = "TrungLuong080699!!!";
@@ -81,20 +102,24 @@ const char *ALERT_TOPIC = "alerts/BIK_298A1J35"; // alerts topic
 const char *ALERT_TOPIC_TOPPLE = "alerts/topple/BIK_298A1J35";
 const char *ALERT_TOPIC_GEOFENCE = "alerts/geofence/BIK_298A1J35";
 const char *ALERT_TOPIC_BATTERY = "alerts/battery/BIK_298A1J35";
+const char *ALERT_TOPIC_CRASH = "alerts/crash/BIK_298A1J35";
+const char *ALERT_TOPIC_THEFT = "alerts/theft/BIK_298A1J35";
+const char *GEOFENCE_SYNC_TOPIC = "geofence/sync/BIK_298A1J35";   // xe → server: tile + version đang có
+const char *GEOFENCE_TILE_TOPIC = "geofence/tiles/BIK_298A1J35";  // server → xe: FULL / DIFF / UNCHANGED
 
 Alert *toppleAlert = nullptr;
 Alert *lowBatteryAlert = nullptr;
 Alert *geofenceAlert = nullptr;
 
-// GSM configuration (Serial2 = modem)
+// GSM configuration (USART2 = modem)
 GsmConfiguration gsm(
-    Serial2,
+    Uart2,
     APN, GPRS_USER, GPRS_PASS,
     MQTT_HOST, MQTT_PORT,
     MQTT_USER, MQTT_PASS);
 
-// HTTP utility (dùng netClient + mqtt bên trong gsm)
-HttpConfiguration http(gsm.netClient, &gsm.mqtt);
+// HTTP utility (socket riêng httpClient, MQTT giữ nguyên kết nối)
+HttpConfiguration http(gsm.httpClient, &gsm.mqtt);
 
 // Time from modem
 TimeConfiguration timeConfig(gsm.modem);
@@ -105,8 +130,28 @@ QrScannerUtilityNonBlocking qrScanner(qrSerial);
 // Network scheduler
 NetworkInterfaceScheduler netScheduler;
 
+// RSSI / RAT monitor (sampled by LinkQualitySampleTask)
+LinkQualityMonitor linkMonitor;
+
 int batteryLevel = 100;
 float currentSpeedKmh = 0;
+
+// Tốc độ (GPS + IMU) + odometer → currentSpeedKmh
+MotionEngine motion(currentSpeedKmh);
+
+// Track chuyến đi (polyline) – gửi kèm termination
+TripTrackRecorder tripTrack;
+
+// Tổng hợp chuyến (quãng đường, thời gian, tốc độ, mAh, alert) – gửi kèm termination
+TripSummaryAggregator tripSummary;
+
+// Vùng hoạt động / cấm: tile tải qua MQTT (EEPROM), fallback bảng build sẵn
+// trong firmware (GeofenceZones.h) khi chưa có tile cho vị trí hiện tại
+ProgmemZoneSource builtinZones(GEOFENCE_POLYGONS, GEOFENCE_POLYGON_COUNT, GEOFENCE_VERTICES);
+GeofenceTileStore geoTiles;
+GeofenceEngine geofence(builtinZones);
+const GeoZoneSource *activeZones = &builtinZones;
+bool geoZonesChanged = false; // set bởi GeofenceTileSyncTask
 bool toBeUpdated = true;
 DisplayPage currentPage = DisplayPage::QrScan;
 DisplayPage prevPage = DisplayPage::QrScan;
@@ -147,6 +192,18 @@ ImuConfiguration imu(
     znStableSinceMs,
     znRounded1dp);
 
+// Va chạm: chạy trên từng mẫu thô của FIFO
+CrashDetector crashDetector;
+
+// Phổ rung / độ xóc mặt đường khi INUSED (FFT 128 điểm trên mẫu thô)
+VibrationAnalyzer vibration;
+
+// Xe đỗ: MCU ngủ giữa các vòng loop(), MPU motion-wake, chống trộm
+ParkGuard parkGuard(imu);
+
+// SRAM: static / heap / khoảng trống heap ↔ stack nhỏ nhất (stack painting)
+MemoryMonitor memMonitor;
+
 // =====================================================
 //  GLOBAL CONFIG
 // =====================================================
@@ -154,6 +211,7 @@ ImuConfiguration imu(
 // ----------------- Objects / utilities -----------------
 
 CellInfo cellInfo;
+CellLocationCache cellCache;
 
 // GPS / bike status
 int64_t currentUnixTime = 0;
@@ -163,6 +221,7 @@ float last_gps_long = 106.754624;
 float last_gps_lat = 10.8514327;
 float cur_lng = 106.754624;
 float cur_lat = 10.8514327;
+LocationSource curLocationSource = LocationSource::NONE; // nguồn của cur_lat / cur_lng
 int64_t last_gps_contact_time = 0;
 OperationState operationState = OperationState::NORMAL;
 UsageState usageState = UsageState::IDLE;
@@ -173,6 +232,7 @@ String currentTripId;
 // in some .cpp
 ValidateTripWithServerTaskMqtt *g_activeValidationTask = nullptr;
 TerminateReservationWithServerMqtt *g_activeTripTerminationTask = nullptr;
+GeofenceTileSyncTask *g_activeGeofenceSyncTask = nullptr;
 
 void globalMqttCallback(char *topic, uint8_t *payload, unsigned int length)
 {
@@ -189,6 +249,14 @@ void globalMqttCallback(char *topic, uint8_t *payload, unsigned int length)
                                                    (const uint8_t *)payload,
                                                    length);
     }
+
+    // topic riêng → không loại trừ với 2 task trên
+    if (g_activeGeofenceSyncTask)
+    {
+        g_activeGeofenceSyncTask->onMqttMessage(topic,
+                                                (const uint8_t *)payload,
+                                                length);
+    }
 }
 
 // =====================================================
@@ -219,14 +287,65 @@ String generateUUID()
     return uuid;
 }
 
-// Placeholder geofence check – implement real logic later
-bool isOutsideAllowedArea(float lat, float lng)
+// -----------------------------------------------------
+// Geofence zones: chọn nguồn polygon cho vị trí hiện tại và xin
+// server các tile quanh xe khi đổi vùng / định kỳ. Không chờ mạng –
+// check luôn chạy trên dữ liệu đang có (tile EEPROM hoặc build sẵn).
+// -----------------------------------------------------
+const unsigned long GEOFENCE_SYNC_INTERVAL_MS = 6UL * 3600UL * 1000UL;
+const int32_t GEOFENCE_PREFETCH_UNITS = 1000; // ~1.1 km tới biên tile → tải trước tile kề
+
+void selectGeofenceZones(int32_t latE7, int32_t lngE7)
 {
-    // TODO: your geofence logic here.
-    // For now always "inside".
-    (void)lat;
-    (void)lng;
-    return false;
+    int32_t lat5 = latE7 / 100;
+    int32_t lng5 = lngE7 / 100;
+
+    const GeoZoneSource *zones = geoTiles.covers(lat5, lng5)
+                                     ? (const GeoZoneSource *)&geoTiles
+                                     : (const GeoZoneSource *)&builtinZones;
+    if (zones != activeZones || geoZonesChanged)
+    {
+        activeZones = zones;
+        geoZonesChanged = false;
+        geofence.setSource(*zones);
+    }
+
+    static char lastTiles[GeofenceTileSyncTask::MAX_TILES][GEOHASH_TILE_LEN];
+    static uint8_t lastTileCount = 0;
+    static unsigned long lastSyncMs = 0;
+
+    char tiles[GeofenceTileSyncTask::MAX_TILES][GEOHASH_TILE_LEN];
+    uint8_t n = geohashTilesAround(lat5, lng5, GEOFENCE_PREFETCH_UNITS, tiles);
+
+    bool moved = (n != lastTileCount) || memcmp(tiles, lastTiles, n * GEOHASH_TILE_LEN) != 0;
+    bool due = (lastSyncMs == 0) || (millis() - lastSyncMs >= GEOFENCE_SYNC_INTERVAL_MS);
+    if ((!moved && !due) || g_activeGeofenceSyncTask || !gsm.mqttConnected())
+        return;
+
+    if (netScheduler.enqueueIfSpace(
+            new GeofenceTileSyncTask(gsm, geoTiles, GEOFENCE_SYNC_TOPIC, GEOFENCE_TILE_TOPIC,
+                                     tiles, n, geoZonesChanged),
+            TASK_PRIORITY_LOW))
+    {
+        memcpy(lastTiles, tiles, sizeof(tiles));
+        lastTileCount = n;
+        lastSyncMs = millis();
+    }
+}
+
+// -----------------------------------------------------
+// Xe đỗ: điều kiện thức dậy khi MCU đang ngủ (gọi khi ngắt đã tắt).
+// GPS stream liên tục → chỉ thức khi ring đã đầy nửa, còn lại tick 1 s.
+// -----------------------------------------------------
+bool parkWakePending()
+{
+    return imu.needsService() ||
+           geoTiles.busy() ||
+           Uart2.available() ||
+           Serial.available() ||
+           Serial3.available() ||
+           qrSerial.available() ||
+           Uart1.available() >= UART1_RX_BUFFER_SIZE / 2;
 }
 
 // =====================================================
@@ -288,7 +407,7 @@ void testHttp()
     const int port = 80;
     const char *path = "/";
 
-    if (!gsm.netClient.connect(host, port))
+    if (!gsm.httpClient.connect(host, port))
     {
         Serial.println("[HTTP] TCP connect FAILED");
         return;
@@ -296,29 +415,88 @@ void testHttp()
 
     Serial.println("[HTTP] TCP connected");
 
-    // Send HTTP GET
-    gsm.netClient.print(String("GET ") + path + " HTTP/1.1\r\n");
-    gsm.netClient.print(String("Host: ") + host + "\r\n");
-    gsm.netClient.print("Connection: close\r\n\r\n");
-
-    // Read response
+    // Send HTTP GET (gom thành 1 lần ghi xuống modem)
+    BufferedClient out(gsm.httpClient);
+    uint32_t sendStartMs = millis();
+    out.print(String("GET ") + path + " HTTP/1.1\r\n");
+    out.print(String("Host: ") + host + "\r\n");
+    out.print("Connection: close\r\n\r\n");
+    out.flush();
+
+    Serial.print("[HTTP] writes=");
+    Serial.print(out.writeCalls);
+    Serial.print(" modemSends=");
+    Serial.print(out.modemSends);
+    Serial.print(" sendMs=");
+    Serial.println(millis() - sendStartMs);
+
+    // Read response (bulk read theo khối)
+    uint8_t chunk[64];
+    uint32_t rxBytes = 0;
+    uint32_t rxReads = 0;
+    uint32_t rxStartMs = 0;
+    uint32_t rxLastMs = 0;
     unsigned long timeout = millis();
-    while (gsm.netClient.connected() && millis() - timeout < 8000)
+    while (gsm.httpClient.connected() && millis() - timeout < 8000)
     {
-        while (gsm.netClient.available())
+        while (gsm.httpClient.available() > 0)
         {
-            char c = gsm.netClient.read();
-            Serial.write(c);
+            int n = gsm.httpClient.read(chunk, sizeof(chunk));
+            if (n <= 0)
+                break;
+            if (rxBytes == 0)
+                rxStartMs = millis();
+            rxLastMs = millis();
+            rxBytes += n;
+            rxReads++;
+            Serial.write(chunk, n);
             timeout = millis();
         }
     }
 
-    gsm.netClient.stop();
+    gsm.httpClient.stop();
+    if (rxBytes == 0)
+    {
+        // không byte nào → không có latency để báo (rxStartMs vẫn = 0)
+        Serial.print("[HTTP] rx timeout, no bytes after ms=");
+        Serial.println(millis() - sendStartMs);
+        return;
+    }
+
+    // đầu → cuối byte nhận, không gồm thời gian chờ đóng socket
+    uint32_t rxMs = rxLastMs - rxStartMs;
     Serial.println("\n[HTTP] Done");
+    Serial.print("[HTTP] rx bytes=");
+    Serial.print(rxBytes);
+    Serial.print(" reads=");
+    Serial.print(rxReads);
+    Serial.print(" ms=");
+    Serial.println(rxMs);
+}
+
+// Encode alert rồi enqueue CRITICAL. noinline: buffer 256 B chỉ nằm trên
+// stack trong lúc gọi hàm này, không cộng vào khung stack của loop().
+// withTrace: alert va chạm, task stream thêm trace từ CrashDetector.
+__attribute__((noinline)) bool enqueueAlert(const Alert &alert, const char *topic, bool withTrace = false)
+{
+    uint8_t alertBuf[256];
+    int alertLen = encodeAlert(alert, alertBuf);
+
+    NetworkTask *alertTask;
+    if (withTrace)
+        alertTask = new PublishCrashAlertTask(gsm, crashDetector, alertBuf, alertLen, topic);
+    else
+        alertTask = new PublishMqttTask(gsm, alertBuf, alertLen, topic);
+    if (!alertTask)
+        return false;
+
+    netScheduler.enqueue(alertTask, TASK_PRIORITY_CRITICAL);
+    return true;
 }
 
 void setup()
 {
+    memMonitor.begin(); // tô stack trước mọi thứ khác
     Serial.begin(115200);
 
     pinMode(HELMET_PIN, INPUT_PULLUP);
@@ -333,8 +511,14 @@ void setup()
     u8g2.begin(); // REQUIRED
     ina219.begin();
     batteryManager.begin();
+    cellCache.begin();
+    motion.begin();
+    geoTiles.begin();
+    geofence.begin();
     toBeUpdated = true; // force first draw
     Serial3.begin(9600);
+    imu.crashDetector = &crashDetector;
+    imu.vibration = &vibration;
     imu.begin();
     pinMode(STRAIGHT_LEFT, OUTPUT);
     pinMode(BACK_LEFT, OUTPUT);
@@ -355,6 +539,8 @@ void setup()
 
     // GPS
     gpsConfiguration.begin(); // NEO-M10: 38400 bên trong GpsConfiguration */
+    locationArbiter.addProvider(&neoLocation);   // đăng ký trước → thắng khi hoà điểm
+    locationArbiter.addProvider(&modemLocation);
 
     Serial.println("Setup Done");
 
@@ -393,6 +579,8 @@ void setup()
         Serial.println("[MQTT] connected");
     }
     gsm.mqtt.setCallback(globalMqttCallback);
+    // tile geofence FULL tới ~270 bytes (topic + header + 240 data)
+    gsm.mqtt.setBufferSize(320);
 }
 
 // =====================================================
@@ -405,12 +593,53 @@ void loop()
     unsigned long now = millis();
     static unsigned long lastToppleAlert = 0;
 
-    
+    // IMU: rút FIFO theo lô (~100 ms, đếm bằng INT data-ready); currentState
+    // được cập nhật trên luồng đã lọc
+    vibration.setEnabled(usageState == UsageState::INUSED);
+    if (imu.update())
+    {
+        // gia tốc dọc xe đã lọc (±16 g) cho MotionEngine
+        motion.onAccel(accelX, IMU_ACCEL_LSB_PER_G);
+    }
+
+    // Va chạm đã xác nhận (peak + jerk + đổi hướng) → alert CRASH kèm trace
+    static unsigned long crashAtMs = 0;
+    if (crashDetector.hasEvent())
+    {
+        Serial.println(F("[IMU] Crash detected, sending CRASH alert"));
+        Alert alert;
+        alert.id = generateUUID();
+        alert.bike_id = bikeUserName;
+        alert.content = "Xe BIK_298A1J35 có dấu hiệu va chạm. Xin vui lòng kiểm tra";
+        alert.type = AlertType::CRASH;
+        alert.longitude = cur_lng;
+        alert.latitude = cur_lat;
+        alert.time = currentUnixTime;
+
+        // alert + [trace len u16 LE][trace]; trace stream thẳng từ
+        // CrashDetector, task giải phóng event khi xong
+        if (enqueueAlert(alert, ALERT_TOPIC_CRASH, true))
+        {
+            isCrashed = true;
+            crashAtMs = now;
+            tripSummary.onAlert(AlertType::CRASH);
+        }
+        else
+        {
+            // event vẫn pending → thử lại vòng sau
+            Serial.println(F("[IMU] CRASH alert: out of memory"));
+        }
+    }
+    else if (isCrashed && currentState == VehicleState::UPRIGHT && now - crashAtMs >= 60000UL)
+    {
+        // xe đã được dựng lại và yên 1 phút → bỏ cờ va chạm
+        isCrashed = false;
+    }
+
     if (now - lastToppleAlert > 1000UL)
     {
         lastToppleAlert = now;
-        // Update IMU (imu.update() sẽ tự update currentState theo logic bạn đã viết)
-        if (imu.update())
+        if (imu.initialized)
         {
             // 1) Chỉ gửi alert khi KHÔNG UPRIGHT
             if (currentState != VehicleState::UPRIGHT)
@@ -431,21 +660,13 @@ void loop()
                     // (khuyến nghị) include state để backend hiểu nguyên nhân
                     // alert.state = (int)currentState;            // nếu struct Alert có field
 
-                    // 3) Encode
-                    uint8_t alertBuf[256];
-                    int alertLen = encodeAlert(alert, alertBuf);
                     isToppled = true;
 
                     toppleAlert = &alert;
 
-                    // 4) Publish MQTT qua scheduler
-                    NetworkTask *alertTask = new PublishMqttTask(
-                        gsm,
-                        alertBuf,
-                        alertLen,
-                        ALERT_TOPIC_TOPPLE);
-
-                    netScheduler.enqueue(alertTask, TASK_PRIORITY_CRITICAL);
+                    // 3) Encode + publish MQTT qua scheduler
+                    enqueueAlert(alert, ALERT_TOPIC_TOPPLE);
+                    tripSummary.onAlert(AlertType::TOPPLE);
                 }
             }
             else
@@ -457,7 +678,7 @@ void loop()
         }
         else
         {
-            Serial.println(F("[IMU] Not initialized / update failed"));
+            Serial.println(F("[IMU] Not initialized"));
         }
     }
         
@@ -466,9 +687,39 @@ void loop()
     
 
 
+    // Tile geofence vừa nhận: ghi EEPROM dần, xong → nạp lại nguồn polygon
+    if (geoTiles.service())
+        geoZonesChanged = true;
+
     batteryManager.update();
+    tripSummary.onBattery(batteryManager.mAhUsed);
+
+    // Xe đỗ: sustained motion không có chuyến → alert chống trộm
+    parkGuard.update(now,
+                     usageState == UsageState::IDLE && currentTripId.length() == 0,
+                     batteryManager.lastCurrent_mA);
+    if (parkGuard.hasTheftEvent())
+    {
+        Serial.println(F("[PARK] Motion without trip, sending THEFT alert"));
+        Alert alert;
+        alert.id = generateUUID();
+        alert.bike_id = bikeUserName;
+        alert.content = "Xe BIK_298A1J35 bị di chuyển khi không có chuyến. Xin vui lòng kiểm tra";
+        alert.type = AlertType::THEFT;
+        alert.longitude = cur_lng;
+        alert.latitude = cur_lat;
+        alert.time = currentUnixTime;
+
+        enqueueAlert(alert, ALERT_TOPIC_THEFT);
+        parkGuard.clearTheftEvent();
+    }
+    static bool lowBatteryCounted = false;
         if (batteryLevel <= 49)
         {
+            // alert gửi lặp mỗi vòng, summary chỉ đếm lần vào vùng pin yếu
+            if (!lowBatteryCounted)
+                tripSummary.onAlert(AlertType::LOW_BATTERY);
+            lowBatteryCounted = true;
             currentPage = DisplayPage::LowBatteryAlert;
             //Serial.println(F("[ALERT] Low battery zone, enqueue alert"));
             Alert alert;
@@ -481,16 +732,13 @@ void loop()
             alert.time = currentUnixTime;
 
             
-            uint8_t alertBuf[256];
-            int alertLen = encodeAlert(alert, alertBuf);
-            NetworkTask *alertTask = new PublishMqttTask(
-                gsm,
-                alertBuf,
-                alertLen,
-                ALERT_TOPIC);
-            netScheduler.enqueue(alertTask, TASK_PRIORITY_CRITICAL);
+            enqueueAlert(alert, ALERT_TOPIC);
             
         }
+        else
+        {
+            lowBatteryCounted = false;
+        }
     
     
     
@@ -664,6 +912,17 @@ void loop()
                 TripTerminationPayload tripTerminationPayload = {
                     .end_lng = cur_lng,
                     .end_lat = cur_lat};
+                tripTerminationPayload.summary_version = TRIP_SUMMARY_VERSION;
+                tripSummary.finish(millis(), tripTerminationPayload.summary);
+
+                static char trackTopic[96];
+                snprintf(
+                    trackTopic,
+                    sizeof(trackTopic),
+                    "/reservation/%s/%s/track",
+                    bikeUserName.c_str(),
+                    currentTripId.c_str());
+                tripTrack.finish();
 
                 NetworkTask *task = new TerminateReservationWithServerMqtt(
                     gsm,
@@ -674,10 +933,13 @@ void loop()
                     usageState,
                     currentPage,
                     prevPage,
-                    toBeUpdated);
+                    toBeUpdated,
+                    trackTopic,
+                    &tripTrack);
 
                 netScheduler.enqueue(task, TASK_PRIORITY_CRITICAL);
                 usageState = UsageState::IDLE;
+                motion.endTrip();
             }
         }
     }
@@ -687,6 +949,9 @@ void loop()
         {
             toBeUpdated = true;
             usageState = UsageState::INUSED;
+            motion.startTrip();
+            tripTrack.start(millis());
+            tripSummary.start(millis(), batteryManager.mAhUsed);
             Serial.println(F("[HELMET] Helmet removed, bike IN_USED"));
             currentPage = DisplayPage::Welcome;
             prevPage = DisplayPage::QrScan;
@@ -702,6 +967,30 @@ void loop()
 
     gpsConfiguration.update();
 
+    // mỗi fix NEO mới (1 Hz NMEA / 5 Hz UBX) → tốc độ + odometer
+    static uint32_t lastMotionFixCount = 0;
+    if (gpsConfiguration.fixCount != lastMotionFixCount)
+    {
+        lastMotionFixCount = gpsConfiguration.fixCount;
+        int32_t latE7, lonE7;
+        if (gpsConfiguration.getLocationE7(latE7, lonE7))
+        {
+            motion.onGpsFix(latE7, lonE7, gpsConfiguration.groundSpeedMmS());
+            if (usageState == UsageState::INUSED)
+                tripTrack.onFix(latE7, lonE7, millis());
+            tripSummary.onMotion(motion.tripMeters(), motion.speedMmPerS(), millis());
+
+            // chỉ vẽ lại LCD khi số hiển thị (0.1 km/h) đổi
+            static int16_t lastShownSpeedX10 = -1;
+            int16_t shownX10 = (int16_t)(currentSpeedKmh * 10.0f + 0.5f);
+            if (shownX10 != lastShownSpeedX10)
+            {
+                lastShownSpeedX10 = shownX10;
+                toBeUpdated = true;
+            }
+        }
+    }
+
     static unsigned long lastGpsPrint = 0;
     static float lastLat = 10.85766, lastLng = 106.76659;
     static unsigned long last_geolocation = 0;
@@ -712,9 +1001,19 @@ void loop()
            {
                lastGpsPrint = now;
                gpsConfiguration.printDebug();
-               float lat, lng;
-               if (gpsConfiguration.getLocation(lat, lng))
+               LocationFix fix;
+               if (locationArbiter.best(fix))
                {
+                   float lat = fix.lat;
+                   float lng = fix.lng;
+                   curLocationSource = fix.source;
+                   Serial.print(F("[LOC] FIX ("));
+                   Serial.print(LocationArbiter::sourceName(fix.source));
+                   Serial.print(F("): "));
+                   Serial.print(lat, 6);
+                   Serial.print(F(", "));
+                   Serial.println(lng, 6);
+
                    isInside = false;
                    last_gps_lat = lat;
                    last_gps_long = lng;
@@ -724,8 +1023,11 @@ void loop()
                    lastLng = lng;
                    last_gps_contact_time = currentUnixTime;
 
-                   // Check if location is inside allowed area
-                   if (isOutsideAllowedArea(lat, lng))
+                   // Geofence: chỉ báo khi trạng thái trong/ngoài thực sự đổi
+                   int32_t latE7 = lround(lat * 1e7);
+                   int32_t lngE7 = lround(lng * 1e7);
+                   selectGeofenceZones(latE7, lngE7);
+                   if (geofence.update(latE7, lngE7) && geofence.isOutside())
                    {
                        currentPage = DisplayPage::BoundaryCrossAlert;
                        Serial.println(F("[ALERT] Outside allowed boundary, enqueue alert"));
@@ -739,16 +1041,16 @@ void loop()
                        alert.latitude = lat;
                        alert.time = currentUnixTime;
                        operationState = OUT_OF_BOUND;
+                       isOutOfBound = true;
 
-                       uint8_t alertBuf[256];
-                       int alertLen = encodeAlert(alert, alertBuf);
-
-                       NetworkTask *alertTask = new PublishMqttTask(
-                           gsm,
-                           alertBuf,
-                           alertLen,
-                           ALERT_TOPIC);
-                       netScheduler.enqueue(alertTask, TASK_PRIORITY_CRITICAL);
+                       enqueueAlert(alert, ALERT_TOPIC);
+                       tripSummary.onAlert(AlertType::BOUNDARY_CROSS);
+                   }
+                   else if (isOutOfBound && !geofence.isOutside())
+                   {
+                       Serial.println(F("[GEOFENCE] Back inside allowed area"));
+                       operationState = NORMAL;
+                       isOutOfBound = false;
                    }
                }
                else
@@ -760,9 +1062,12 @@ void loop()
                // -------------------------------------------------
                // 3) Indoor logic – enqueue cell / geolocation tasks
                // -------------------------------------------------
-               /*
-               if (isInside && now - last_geolocation >= 10000)
+               // Cache theo cell trước, chỉ gọi UnwiredLabs (tính phí) khi
+               // miss / stale; sóng yếu → hoãn (LinkQualityMonitor)
+               if (isInside && now - last_geolocation >= 10000 &&
+                   !linkMonitor.shouldDeferBulk())
                {
+                   last_geolocation = now;
 
                    if (cellInfo.isOutdated)
                    {
@@ -774,19 +1079,42 @@ void loop()
                    }
                    else
                    {
-                       // we have a CellInfo → call UnwiredLabs for approximate location
-                       Serial.println(F("[INDOOR] Have CellInfo, enqueue QueryGeolocationApiTask"));
-
-                       NetworkTask *geoTask = new QueryGeolocationApiTask(
-                           http,
-                           cellInfo,
-                           cur_lat,
-                           cur_lng);
-                       netScheduler.enqueue(geoTask, TASK_PRIORITY_LOW);
+                       uint32_t nowS = (uint32_t)(currentUnixTime / 1000);
+                       float cachedLat, cachedLng;
+                       CellLocationCache::Result r =
+                           cellCache.lookup(cellInfo, nowS, cachedLat, cachedLng);
+
+                       if (r != CellLocationCache::MISS)
+                       {
+                           // HIT (hoặc STALE: dùng tạm trong lúc refresh)
+                           cur_lat = cachedLat;
+                           cur_lng = cachedLng;
+                           curLocationSource = LocationSource::CELL;
+                       }
+
+                       if (r == CellLocationCache::HIT)
+                       {
+                           Serial.println(F("[INDOOR] Cell location from cache, skip UnwiredLabs"));
+                           cellInfo.isOutdated = true;
+                       }
+                       else
+                       {
+                           // miss / stale → call UnwiredLabs for approximate location
+                           Serial.println(F("[INDOOR] Cache miss/stale, enqueue QueryGeolocationApiTask"));
+
+                           NetworkTask *geoTask = new QueryGeolocationApiTask(
+                               http,
+                               cellInfo,
+                               cur_lat,
+                               cur_lng,
+                               &cellCache,
+                               nowS,
+                               &curLocationSource);   // CELL chỉ khi có kết quả
+                           netScheduler.enqueue(geoTask, TASK_PRIORITY_LOW);
+                       }
                    }
                }
-                   */
-                   
+
 
            }
            
@@ -798,7 +1126,8 @@ void loop()
 
     
     static unsigned long lastTelemetry = 0;
-    if (now - lastTelemetry >= 5000)
+    // sóng yếu → giãn chu kỳ telemetry để giảm publish thất bại / gửi lại
+    if (now - lastTelemetry >= linkMonitor.telemetryIntervalMs(5000))
     {
         lastTelemetry = now;
         // float vbatt = readBatteryVoltage();
@@ -817,6 +1146,19 @@ void loop()
         t.isToppled = isToppled;
         t.isOutOfBound = isOutOfBound;
         t.usageState = usageState;
+        t.linkRssiDbm = linkMonitor.rssiDbm();
+        t.linkQuality = (uint8_t)linkMonitor.quality();
+        t.linkRat = (uint8_t)linkMonitor.rat;
+        t.locationSource = (uint8_t)curLocationSource;
+
+        // Phổ rung: gộp ~60 s rồi mới gửi kèm 1 lần (không gửi mẫu thô)
+        static unsigned long lastVibration = 0;
+        if (usageState == UsageState::INUSED && now - lastVibration >= 60000UL &&
+            vibration.takeSummary(t.vibration))
+        {
+            lastVibration = now;
+            t.vibrationVersion = VIBRATION_SUMMARY_VERSION;
+        }
 
         uint8_t buffer[256];
         int payloadLen = encodeTelemetry(t, buffer);
@@ -832,6 +1174,52 @@ void loop()
         netScheduler.enqueue(teleTask, TASK_PRIORITY_NORMAL);
     }
 
+    // -------------------------------------------------
+    // 6b) LINK QUALITY – lấy mẫu CSQ/CPSI mỗi 30 giây (low priority)
+    // -------------------------------------------------
+    static unsigned long lastLinkSample = 0;
+    if (now - lastLinkSample >= 30000UL)
+    {
+        lastLinkSample = now;
+        netScheduler.enqueueIfSpace(
+            new LinkQualitySampleTask(gsm, linkMonitor),
+            TASK_PRIORITY_LOW);
+    }
+
+    // -------------------------------------------------
+    // 6c) MODEM GNSS – NEO-M10 mất fix → hỏi GNSS của SIM7600 mỗi 5 giây
+    //     (thay cho CPSI → UnwiredLabs trong phần lớn trường hợp). NEO có
+    //     fix lại liên tục POWER_OFF_AFTER_MS → tắt GNSS modem (AT+CGPS=0)
+    // -------------------------------------------------
+    static unsigned long lastModemGnssPoll = 0;
+    static unsigned long primaryFixSinceMs = 0;
+    static bool primaryFixStable = false;
+    bool primaryFix = locationArbiter.primaryHasFix();
+    if (!primaryFix)
+        primaryFixStable = false;
+    else if (!primaryFixStable)
+    {
+        primaryFixStable = true;
+        primaryFixSinceMs = now;
+    }
+
+    if (!primaryFix && now - lastModemGnssPoll >= 5000UL)
+    {
+        lastModemGnssPoll = now;
+        netScheduler.enqueueIfSpace(
+            new ModemGnssPollTask(gsm, modemLocation),
+            TASK_PRIORITY_LOW);
+    }
+    else if (primaryFix && modemLocation.powered &&
+             now - primaryFixSinceMs >= ModemGnssLocationProvider::POWER_OFF_AFTER_MS &&
+             now - lastModemGnssPoll >= 5000UL)
+    {
+        lastModemGnssPoll = now;
+        netScheduler.enqueueIfSpace(
+            new ModemGnssPollTask(gsm, modemLocation, true),
+            TASK_PRIORITY_LOW);
+    }
+
     // -------------------------------------------------
     // 7) Run one network task from scheduler
     // -------------------------------------------------
@@ -847,15 +1235,44 @@ void loop()
             new MqttMaintenanceTask(gsm),
             TASK_PRIORITY_LOW);
 
-        /*
-    netScheduler.enqueueIfSpace(
-        new HttpMaintenanceTask(http),
-        TASK_PRIORITY_LOW);
-        */
+        // HTTP: bơm response + đóng socket keep-alive khi rảnh quá lâu
+        netScheduler.enqueueIfSpace(
+            new HttpMaintenanceTask(http),
+            TASK_PRIORITY_LOW);
         
     }
-        
-    
+
+    // -------------------------------------------------
+    // 8) Diagnostics – in thống kê mỗi 60 giây
+    // -------------------------------------------------
+    static unsigned long lastDiag = 0;
+    if (now - lastDiag >= 60000UL)
+    {
+        lastDiag = now;
+        gsm.printStats();
+        http.printStats();
+        linkMonitor.printStats();
+        cellCache.printStats();
+        locationArbiter.printStats();
+        gpsConfiguration.printBenchmark();
+        motion.printStats();
+        geofence.printStats();
+        geoTiles.printStats();
+        imu.printStats();
+        crashDetector.printStats();
+        vibration.printStats();
+        batteryManager.printStats();
+        parkGuard.printStats();
+        Uart1.printStats(F("gps"));
+        Uart2.printStats(F("modem"));
+        memMonitor.printStats();
+    }
 
     displayTask.display();
+
+    // -------------------------------------------------
+    // 9) Xe đỗ: ngủ tới khi có ngắt / byte UART / tick 1 s
+    // -------------------------------------------------
+    if (parkGuard.canSleep() && netScheduler.size() == 0)
+        parkGuard.sleep(parkWakePending);
 }
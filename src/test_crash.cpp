@@ -0,0 +1,153 @@
+#include <Arduino.h>
+#include "ImuConfiguration/CrashDetector.h"
+
+// =====================================================
+// CrashDetector: phát lại trace tổng hợp (mẫu thô 100 Hz, ±16 g)
+//
+// Mỗi kịch bản 10 s, va chạm / ổ gà ở giây thứ 3. In kết quả xác nhận
+// và µs / mẫu (trung bình + max, max gồm cả lần dồn 1 s trước khi kích
+// hoạt). Build riêng (đổi src_filter sang +<test_crash.cpp>), mở
+// Serial 115200.
+// =====================================================
+
+enum Scenario : uint8_t
+{
+    QUIET_RIDE = 0,
+    POTHOLE,         // spike 6 g, jerk cao, xe vẫn đứng → loại (đổi hướng)
+    RAMPED_BUMP,     // 5.6 g tăng dần 200 ms → loại (jerk)
+    CRASH_ON_SIDE,   // 9 g, nằm nghiêng sau 0.5 s → CRASH
+    CRASH_SATURATED, // bão hoà ±16 g, lật ngửa → CRASH
+    SCENARIO_COUNT
+};
+
+static const char *const SCENARIO_NAMES[] = {
+    "quiet ride", "pothole", "ramped bump", "crash on side", "crash saturated"};
+
+static const bool SCENARIO_EXPECT[] = {false, false, false, true, true};
+
+static const uint16_t SAMPLES = 10 * IMU_SAMPLE_RATE_HZ;
+static const uint16_t IMPACT = 3 * IMU_SAMPLE_RATE_HZ;
+
+// nhiễu đường ~±0.1 g
+static int16_t noise(int16_t amp)
+{
+    return (int16_t)random(-amp, amp + 1);
+}
+
+static int16_t clamp16(int32_t v)
+{
+    return (int16_t)constrain(v, -32768L, 32767L);
+}
+
+static void makeSample(Scenario sc, uint16_t k, ImuSample &s)
+{
+    const int32_t G = IMU_ACCEL_LSB_PER_G;
+    int32_t x = noise(200), y = noise(200), z = G + noise(200);
+
+    switch (sc)
+    {
+    case POTHOLE:
+        if (k == IMPACT)
+            z += 6 * G;
+        else if (k == IMPACT + 1)
+            z -= 2 * G;
+        break;
+    case RAMPED_BUMP:
+        if (k + 20 > IMPACT && k < IMPACT + 20)
+            x += (int32_t)(20 - abs((int16_t)(k - IMPACT))) * 28 * G / 100;
+        break;
+    case CRASH_ON_SIDE:
+        if (k >= IMPACT && k < IMPACT + 6)
+        {
+            x = -9 * G + noise(G);
+            y = noise(3 * G);
+        }
+        else if (k >= IMPACT + 50)
+        {
+            x = noise(40);
+            y = G + noise(40);
+            z = noise(40);
+        }
+        else if (k >= IMPACT)
+        {
+            x = noise(G / 2);
+            y = noise(G);
+            z = noise(G);
+        }
+        break;
+    case CRASH_SATURATED:
+        if (k >= IMPACT && k < IMPACT + 4)
+        {
+            x = -20 * G;
+            y = 10 * G;
+            z = -5 * G;
+        }
+        else if (k >= IMPACT + 4)
+        {
+            z = -G + noise(300);
+        }
+        break;
+    default:
+        break;
+    }
+
+    s.ax = clamp16(x);
+    s.ay = clamp16(y);
+    s.az = clamp16(z);
+    s.gx = s.gy = s.gz = 0;
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial) {}
+
+    Serial.println(F("=== CrashDetector replay ==="));
+    randomSeed(1);
+
+    for (uint8_t sc = 0; sc < SCENARIO_COUNT; ++sc)
+    {
+        CrashDetector det;
+
+        bool confirmed = false;
+        uint16_t traceBytes = 0;
+        uint32_t total = 0, maxUs = 0;
+
+        for (uint16_t k = 0; k < SAMPLES; ++k)
+        {
+            ImuSample s;
+            makeSample((Scenario)sc, k, s);
+
+            uint32_t t0 = micros();
+            det.onSample(s);
+            uint32_t dt = micros() - t0;
+
+            total += dt;
+            if (dt > maxUs)
+                maxUs = dt;
+
+            if (det.hasEvent())
+            {
+                confirmed = true;
+                traceBytes = det.traceLength();
+                det.clearEvent();
+            }
+        }
+
+        Serial.print(SCENARIO_NAMES[sc]);
+        Serial.print(F(": crash="));
+        Serial.print(confirmed);
+        Serial.print(confirmed == SCENARIO_EXPECT[sc] ? F(" OK") : F(" FAIL"));
+        Serial.print(F(" trace(B)="));
+        Serial.print(traceBytes);
+        Serial.print(F(" avgUs="));
+        Serial.print(total / SAMPLES);
+        Serial.print(F(" maxUs="));
+        Serial.println(maxUs);
+        det.printStats();
+    }
+}
+
+void loop()
+{
+}
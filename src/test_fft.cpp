@@ -0,0 +1,77 @@
+#include <Arduino.h>
+#include "ImuConfiguration/VibrationAnalyzer.h"
+
+// =====================================================
+// VibrationAnalyzer: số chu kỳ CPU / cửa sổ 128 điểm
+//
+// Cửa sổ tổng hợp: 1 g + sin biên độ 0.3 g ở tần số giữa từng dải +
+// nhiễu ±0.02 g. In µs / cycles cho 1 cửa sổ (Hann + FFT + dải), dải có
+// năng lượng lớn nhất (phải trùng dải đã phát) và roughness (kỳ vọng
+// ≈ 0.3 / √2 ≈ 212 mg). Build riêng (đổi src_filter sang
+// +<test_fft.cpp>), Serial 115200.
+// =====================================================
+
+static const uint8_t WINDOWS_PER_BAND = 4;
+
+VibrationAnalyzer vib;
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial) {}
+
+    Serial.println(F("=== VibrationAnalyzer 128-point FFT ==="));
+    randomSeed(1);
+    vib.setEnabled(true);
+
+    const float binHz = (float)IMU_SAMPLE_RATE_HZ / FFT_N;
+    uint32_t n = 0;
+
+    for (uint8_t band = 0; band < VibrationAnalyzer::BANDS; ++band)
+    {
+        float hz = (band * VibrationAnalyzer::BINS_PER_BAND + VibrationAnalyzer::BINS_PER_BAND / 2) * binHz;
+
+        for (uint16_t k = 0; k < WINDOWS_PER_BAND * FFT_N; ++k, ++n)
+        {
+            ImuSample s = {};
+            float t = (float)n / IMU_SAMPLE_RATE_HZ;
+            s.az = (int16_t)(IMU_ACCEL_LSB_PER_G * (1.0f + 0.3f * sinf(2 * PI * hz * t))) +
+                   (int16_t)random(-40, 41);
+            vib.onSample(s);
+        }
+
+        VibrationSummary sum;
+        vib.takeSummary(sum);
+
+        uint8_t peak = 0;
+        for (uint8_t b = 1; b < VibrationAnalyzer::BANDS; ++b)
+            if (sum.bands[b] > sum.bands[peak])
+                peak = b;
+
+        Serial.print(F("tone "));
+        Serial.print(hz, 2);
+        Serial.print(F(" Hz band="));
+        Serial.print(band);
+        Serial.print(F(" peak="));
+        Serial.print(peak);
+        Serial.print(peak == band ? F(" OK") : F(" FAIL"));
+        Serial.print(F(" roughness(mg)="));
+        Serial.print(sum.roughness_mg);
+        Serial.print(F(" bands="));
+        for (uint8_t b = 0; b < VibrationAnalyzer::BANDS; ++b)
+        {
+            Serial.print(sum.bands[b]);
+            Serial.print(b + 1 < VibrationAnalyzer::BANDS ? ',' : ' ');
+        }
+        Serial.print(F("us/window="));
+        Serial.print(vib.lastWindowUs);
+        Serial.print(F(" cycles/window="));
+        Serial.println(vib.lastWindowUs * (F_CPU / 1000000UL));
+    }
+
+    vib.printStats();
+}
+
+void loop()
+{
+}
@@ -0,0 +1,1195 @@
+#include <Arduino.h>
+
+// 50 polygon > 32 → mask grid 64-bit
+#define GEOFENCE_MAX_POLYGONS 64
+#include "GeofenceConfiguration/GeofenceEngine.h"
+
+// =====================================================
+// Geofence benchmark: worst case 50 polygon × 100 đỉnh
+//
+// Mỗi polygon có dải 100 đỉnh răng cưa riêng (bán kính trong / ngoài
+// và góc lệch theo zone, nhiễu giả ngẫu nhiên ±150; 50 × 100 × 4 B =
+// 20 KB PROGMEM), origin lệch nhau 20 đơn vị → bbox / grid đều chứa điểm
+// test → không polygon nào bị loại sớm, mỗi check chạy đủ 50 lần
+// point-in-polygon + khoảng cách tới cạnh trên đỉnh đọc từ flash khác
+// nhau (không trúng mãi một vùng như khi dùng chung dải).
+//
+// Build riêng (đổi src_filter sang +<test_geofence.cpp>), mở
+// Serial 115200: in µs và số chu kỳ CPU / lần check đầy đủ.
+// =====================================================
+
+static const GeoVertex BENCH_VERTICES[] PROGMEM = {
+    // zone 0
+    {14662, 8000}, {14117, 8385}, {14617, 8836}, {13878, 9121}, {14519, 9674},
+    {13598, 9819}, {14049, 10395}, {13340, 10513}, {13757, 11165}, {13164, 11277},
+    {13389, 11915}, {12683, 11874}, {12880, 12583}, {12144, 12413}, {12199, 13076},
+    {11585, 12934}, {11550, 13595}, {10957, 13378}, {10787, 13923}, {10251, 13685},
+    {10054, 14321}, {9477, 13751}, {9224, 14415}, {8744, 13891}, {8412, 14543},
+    {8000, 14042}, {7578, 14705}, {7258, 13872}, {6760, 14502}, {6539, 13690},
+    {5943, 14329}, {5748, 13688}, {5231, 13884}, {5154, 13176}, {4499, 13517},
+    {4409, 12943}, {3885, 12974}, {3906, 12359}, {3169, 12536}, {3379, 11823},
+    {2690, 11858}, {2858, 11263}, {2342, 11111}, {2435, 10619}, {1737, 10480},
+    {2413, 9815}, {1545, 9657}, {2196, 9107}, {1588, 8810}, {1927, 8382},
+    {1338, 8000}, {2040, 7625}, {1459, 7174}, {2076, 6870}, {1600, 6357},
+    {2257, 6134}, {1849, 5564}, {2663, 5489}, {2100, 4756}, {2931, 4783},
+    {2772, 4202}, {3287, 4101}, {3087, 3386}, {3928, 3664}, {3885, 3026},
+    {4550, 3252}, {4442, 2394}, {5040, 2616}, {5251, 2158}, {5775, 2380},
+    {5986, 1802}, {6506, 2181}, {6789, 1653}, {7236, 1950}, {7576, 1267},
+    {8000, 2141}, {8419, 1337}, {8769, 1914}, {9256, 1418}, {9479, 2241},
+    {10085, 1583}, {10220, 2393}, {10786, 2080}, {10876, 2768}, {11587, 2347},
+    {11449, 3253}, {12275, 2832}, {12098, 3636}, {12774, 3517}, {12707, 4106},
+    {13320, 4135}, {13027, 4810}, {13728, 4851}, {13542, 5392}, {14220, 5537},
+    {13812, 6112}, {14481, 6336}, {13754, 6902}, {14488, 7180}, {14041, 7620},
+    // zone 1
+    {14500, 8409}, {13881, 8743}, {14585, 9256}, {13802, 9490}, {14280, 10040},
+    {13660, 10241}, {13974, 10811}, {13229, 10875}, {13708, 11622}, {12897, 11558},
+    {13002, 12138}, {12468, 12196}, {12491, 12782}, {11795, 12588}, {11918, 13392},
+    {11210, 13058}, {11237, 13889}, {10537, 13392}, {10429, 14136}, {9817, 13592},
+    {9616, 14296}, {9095, 13740}, {8825, 14531}, {8367, 13829}, {8000, 14498},
+    {7626, 13948}, {7164, 14618}, {6886, 13839}, {6329, 14510}, {6176, 13614},
+    {5609, 14039}, {5509, 13294}, {4834, 13759}, {4783, 13069}, {4153, 13295},
+    {4218, 12571}, {3395, 12904}, {3623, 12110}, {2982, 12151}, {3150, 11524},
+    {2428, 11536}, {2715, 10905}, {2104, 10774}, {2549, 10158}, {1735, 10035},
+    {2108, 9513}, {1456, 9248}, {2019, 8756}, {1252, 8425}, {2009, 8000},
+    {1420, 7586}, {2193, 7266}, {1557, 6771}, {2211, 6514}, {1675, 5945},
+    {2429, 5794}, {2046, 5198}, {2821, 5153}, {2357, 4419}, {3084, 4429},
+    {2871, 3757}, {3602, 3870}, {3362, 3061}, {4166, 3365}, {4016, 2516},
+    {4827, 3000}, {4744, 2077}, {5438, 2555}, {5538, 1783}, {6193, 2438},
+    {6335, 1515}, {6861, 2027}, {7153, 1299}, {7630, 2117}, {8000, 1294},
+    {8367, 2166}, {8818, 1524}, {9096, 2257}, {9654, 1559}, {9883, 2205},
+    {10411, 1910}, {10567, 2546}, {11253, 2082}, {11178, 2992}, {11901, 2631},
+    {11751, 3466}, {12454, 3257}, {12448, 3823}, {13205, 3694}, {12806, 4509},
+    {13726, 4366}, {13321, 5075}, {14044, 5156}, {13700, 5743}, {14306, 5951},
+    {13798, 6511}, {14601, 6741}, {14029, 7238}, {14705, 7578}, {13982, 8000},
+    // zone 2
+    {14742, 8852}, {13867, 9119}, {14475, 9662}, {13636, 9831}, {14288, 10490},
+    {13473, 10576}, {13818, 11198}, {13165, 11278}, {13454, 11963}, {12493, 11717},
+    {12786, 12494}, {12009, 12270}, {12244, 13130}, {11504, 12823}, {11503, 13519},
+    {10905, 13285}, {10830, 14013}, {10243, 13665}, {10039, 14274}, {9462, 13693},
+    {9233, 14463}, {8764, 14044}, {8425, 14757}, {8000, 14088}, {7574, 14764},
+    {7251, 13930}, {6748, 14566}, {6528, 13735}, {5912, 14425}, {5856, 13414},
+    {5135, 14089}, {5117, 13244}, {4429, 13627}, {4516, 12795}, {3678, 13225},
+    {3896, 12370}, {3050, 12648}, {3478, 11741}, {2513, 11986}, {3023, 11159},
+    {2055, 11268}, {2509, 10584}, {1766, 10468}, {2285, 9857}, {1391, 9697},
+    {2148, 9116}, {1362, 8839}, {2160, 8367}, {1245, 8000}, {2083, 7628},
+    {1323, 7157}, {2111, 6877}, {1671, 6375}, {2408, 6183}, {1693, 5503},
+    {2690, 5502}, {2101, 4757}, {2926, 4780}, {2648, 4112}, {3309, 4119},
+    {3029, 3332}, {3969, 3707}, {3803, 2926}, {4461, 3129}, {4399, 2325},
+    {5054, 2641}, {5207, 2064}, {5785, 2405}, {5917, 1590}, {6542, 2322},
+    {6772, 1565}, {7248, 2049}, {7577, 1284}, {8000, 2006}, {8427, 1219},
+    {8739, 2147}, {9251, 1441}, {9482, 2227}, {10090, 1569}, {10150, 2570},
+    {10850, 1943}, {10878, 2766}, {11586, 2349}, {11578, 3076}, {12169, 2960},
+    {12107, 3626}, {12967, 3335}, {12659, 4146}, {13420, 4062}, {13120, 4751},
+    {13771, 4827}, {13267, 5522}, {14306, 5503}, {13786, 6120}, {14327, 6376},
+    {13974, 6860}, {14613, 7165}, {14050, 7619}, {14785, 8000}, {13843, 8368},
+    // zone 3
+    {14535, 9247}, {13678, 9458}, {14289, 10044}, {13653, 10238}, {14070, 10857},
+    {13254, 10889}, {13767, 11660}, {12772, 11467}, {13191, 12294}, {12403, 12135},
+    {12584, 12881}, {11842, 12644}, {11970, 13465}, {11219, 13073}, {11201, 13823},
+    {10493, 13299}, {10450, 14188}, {9815, 13586}, {9653, 14439}, {9123, 13889},
+    {8826, 14539}, {8379, 14016}, {8000, 14630}, {7628, 13908}, {7173, 14550},
+    {6859, 13982}, {6330, 14503}, {6164, 13650}, {5573, 14129}, {5479, 13358},
+    {4810, 13803}, {4777, 13079}, {4038, 13454}, {4223, 12565}, {3435, 12861},
+    {3678, 12059}, {2834, 12273}, {3096, 11563}, {2284, 11628}, {2892, 10808},
+    {1945, 10849}, {2429, 10206}, {1607, 10077}, {2305, 9462}, {1493, 9241},
+    {2183, 8735}, {1309, 8421}, {2135, 8000}, {1309, 7579}, {1952, 7236},
+    {1359, 6733}, {2260, 6526}, {1615, 5925}, {2431, 5795}, {1949, 5152},
+    {2791, 5136}, {2249, 4350}, {3295, 4581}, {2755, 3661}, {3689, 3952},
+    {3316, 3012}, {4204, 3412}, {4031, 2538}, {4883, 3089}, {4769, 2123},
+    {5429, 2536}, {5563, 1845}, {6121, 2218}, {6356, 1597}, {6860, 2025},
+    {7160, 1352}, {7633, 2172}, {8000, 1278}, {8373, 2072}, {8843, 1326},
+    {9089, 2291}, {9706, 1357}, {9878, 2220}, {10436, 1847}, {10489, 2711},
+    {11184, 2208}, {11264, 2857}, {12013, 2476}, {11754, 3462}, {12651, 3047},
+    {12369, 3898}, {13149, 3740}, {12708, 4580}, {13724, 4368}, {13259, 5109},
+    {14193, 5086}, {13444, 5845}, {14397, 5922}, {13686, 6540}, {14662, 6729},
+    {14001, 7242}, {14589, 7585}, {14030, 8000}, {14671, 8420}, {14020, 8761},
+    // zone 4
+    {14622, 9700}, {13516, 9792}, {14214, 10460}, {13238, 10465}, {13820, 11200},
+    {12970, 11154}, {13372, 11903}, {12486, 11711}, {12972, 12669}, {12096, 12361},
+    {12212, 13092}, {11520, 12844}, {11684, 13805}, {10920, 13311}, {10863, 14084},
+    {10145, 13417}, {10076, 14389}, {9462, 13694}, {9238, 14491}, {8757, 13991},
+    {8415, 14600}, {8000, 14007}, {7570, 14840}, {7247, 13963}, {6742, 14592},
+    {6500, 13842}, {5885, 14508}, {5825, 13494}, {5106, 14150}, {5115, 13248},
+    {4407, 13661}, {4472, 12857}, {3613, 13303}, {3991, 12270}, {3020, 12677},
+    {3419, 11790}, {2588, 11932}, {3100, 11110}, {2148, 11217}, {2666, 10510},
+    {1704, 10493}, {2419, 9813}, {1361, 9705}, {2106, 9124}, {1277, 8849},
+    {2183, 8366}, {1143, 8000}, {2148, 7632}, {1338, 7158}, {2312, 6915},
+    {1396, 6304}, {2434, 6192}, {1591, 5463}, {2687, 5500}, {2129, 4772},
+    {3013, 4835}, {2652, 4114}, {3377, 4175}, {3173, 3467}, {3885, 3617},
+    {3676, 2773}, {4486, 3163}, {4375, 2288}, {5069, 2669}, {5139, 1920},
+    {5810, 2468}, {5915, 1584}, {6521, 2239}, {6755, 1476}, {7248, 2049},
+    {7572, 1200}, {8000, 2140}, {8430, 1172}, {8749, 2073}, {9258, 1407},
+    {9505, 2139}, {10111, 1502}, {10228, 2372}, {10827, 1992}, {10804, 2899},
+    {11664, 2226}, {11572, 3084}, {12330, 2766}, {12129, 3604}, {12948, 3354},
+    {12635, 4166}, {13543, 3972}, {13083, 4774}, {13837, 4791}, {13376, 5470},
+    {14316, 5499}, {13787, 6120}, {14681, 6285}, {13739, 6905}, {14598, 7167},
+    {13833, 7633}, {14891, 8000}, {13828, 8367}, {14656, 8841}, {13709, 9089},
+    // zone 5
+    {14339, 10060}, {13623, 10226}, {14207, 10921}, {13244, 10883}, {13630, 11573},
+    {12846, 11521}, {13174, 12280}, {12248, 11990}, {12686, 12991}, {11863, 12669},
+    {12047, 13570}, {11138, 12944}, {11272, 13952}, {10568, 13458}, {10463, 14220},
+    {9810, 13569}, {9666, 14490}, {9120, 13872}, {8868, 14869}, {8371, 13897},
+    {8000, 14902}, {7634, 13810}, {7155, 14690}, {6919, 13668}, {6294, 14644},
+    {6193, 13563}, {5555, 14176}, {5481, 13354}, {4756, 13900}, {4824, 13005},
+    {4057, 13428}, {4237, 12548}, {3350, 12952}, {3730, 12010}, {2667, 12412},
+    {3212, 11479}, {2356, 11582}, {2735, 10894}, {1844, 10897}, {2534, 10164},
+    {1588, 10083}, {2183, 9494}, {1386, 9262}, {1985, 8760}, {1179, 8429},
+    {2044, 8000}, {1291, 7578}, {2024, 7245}, {1360, 6733}, {2159, 6500},
+    {1472, 5879}, {2400, 5783}, {1829, 5096}, {2690, 5081}, {2196, 4317},
+    {3126, 4459}, {2871, 3757}, {3706, 3967}, {3407, 3109}, {4198, 3405},
+    {4015, 2515}, {4860, 3052}, {4702, 2001}, {5468, 2619}, {5458, 1581},
+    {6157, 2329}, {6320, 1457}, {6864, 2047}, {7148, 1258}, {7631, 2141},
+    {8000, 1353}, {8378, 1995}, {8857, 1216}, {9082, 2327}, {9712, 1330},
+    {9831, 2364}, {10517, 1643}, {10469, 2754}, {11268, 2056}, {11131, 3066},
+    {12048, 2428}, {11707, 3519}, {12640, 3059}, {12338, 3926}, {13336, 3586},
+    {12712, 4577}, {13797, 4321}, {13184, 5150}, {14222, 5072}, {13384, 5868},
+    {14393, 5923}, {13802, 6510}, {14615, 6738}, {13844, 7262}, {14786, 7573},
+    {13838, 8000}, {14808, 8428}, {13741, 8725}, {14558, 9251}, {13868, 9507},
+    // zone 6
+    {14239, 10470}, {13227, 10460}, {13948, 11270}, {12998, 11172}, {13407, 11929},
+    {12491, 11715}, {13022, 12716}, {12020, 12281}, {12355, 13264}, {11506, 12825},
+    {11611, 13691}, {10863, 13208}, {10930, 14226}, {10194, 13542}, {10076, 14388},
+    {9448, 13639}, {9280, 14708}, {8725, 13741}, {8428, 14808}, {8000, 14032},
+    {7568, 14870}, {7261, 13851}, {6698, 14828}, {6560, 13607}, {5912, 14425},
+    {5876, 13365}, {5054, 14260}, {5094, 13287}, {4335, 13775}, {4462, 12869},
+    {3740, 13149}, {3971, 12290}, {3017, 12680}, {3361, 11838}, {2518, 11983},
+    {3123, 11095}, {1949, 11327}, {2662, 10512}, {1612, 10529}, {2281, 9858},
+    {1512, 9666}, {2103, 9125}, {1338, 8842}, {2106, 8371}, {1281, 8000},
+    {2001, 7623}, {1187, 7139}, {2105, 6876}, {1272, 6273}, {2274, 6139},
+    {1725, 5516}, {2601, 5459}, {1980, 4690}, {3074, 4874}, {2543, 4035},
+    {3343, 4147}, {3077, 3377}, {3958, 3695}, {3560, 2633}, {4561, 3267},
+    {4369, 2279}, {5125, 2770}, {5058, 1749}, {5865, 2606}, {5914, 1580},
+    {6508, 2188}, {6746, 1426}, {7274, 2252}, {7578, 1299}, {8000, 1948},
+    {8431, 1145}, {8727, 2246}, {9280, 1288}, {9435, 2410}, {10107, 1517},
+    {10130, 2619}, {10925, 1785}, {10864, 2791}, {11625, 2287}, {11553, 3110},
+    {12433, 2642}, {12004, 3736}, {12916, 3383}, {12457, 4313}, {13514, 3994},
+    {12898, 4892}, {14061, 4668}, {13407, 5456}, {14416, 5460}, {13563, 6193},
+    {14710, 6277}, {13723, 6908}, {14885, 7130}, {13762, 7638}, {14691, 8000},
+    {13797, 8365}, {14895, 8871}, {13830, 9112}, {14494, 9667}, {13476, 9779},
+    // zone 7
+    {14301, 10965}, {13105, 10807}, {13753, 11651}, {12796, 11484}, {13309, 12392},
+    {12321, 12058}, {12771, 13081}, {11668, 12434}, {12016, 13527}, {11140, 12949},
+    {11350, 14093}, {10447, 13199}, {10519, 14362}, {9854, 13706}, {9695, 14603},
+    {9108, 13809}, {8857, 14785}, {8369, 13867}, {8000, 14868}, {7627, 13936},
+    {7156, 14680}, {6920, 13659}, {6292, 14653}, {6159, 13667}, {5507, 14297},
+    {5551, 13205}, {4741, 13928}, {4895, 12893}, {4047, 13441}, {4255, 12527},
+    {3286, 13020}, {3697, 12041}, {2743, 12349}, {3156, 11519}, {2325, 11601},
+    {2897, 10805}, {1692, 10969}, {2581, 10145}, {1429, 10135}, {2347, 9451},
+    {1389, 9261}, {2105, 8745}, {1167, 8430}, {2158, 8000}, {1118, 7567},
+    {2149, 7261}, {1330, 6728}, {2391, 6560}, {1461, 5875}, {2637, 5877},
+    {1859, 5110}, {2780, 5130}, {2105, 4259}, {3308, 4591}, {2676, 3595},
+    {3618, 3885}, {3351, 3050}, {4178, 3380}, {3944, 2418}, {4898, 3111},
+    {4666, 1936}, {5521, 2732}, {5491, 1664}, {6216, 2509}, {6294, 1357},
+    {6899, 2228}, {7146, 1240}, {7632, 2155}, {8000, 1202}, {8376, 2028},
+    {8859, 1203}, {9101, 2226}, {9674, 1479}, {9805, 2446}, {10532, 1606},
+    {10450, 2795}, {11261, 2069}, {11119, 3085}, {12095, 2364}, {11711, 3514},
+    {12626, 3074}, {12339, 3926}, {13370, 3557}, {12687, 4595}, {13822, 4305},
+    {13149, 5169}, {14336, 5019}, {13587, 5788}, {14469, 5898}, {13735, 6528},
+    {14648, 6732}, {13863, 7259}, {14824, 7571}, {13783, 8000}, {14993, 8440},
+    {13788, 8731}, {14855, 9308}, {13696, 9463}, {14488, 10108}, {13350, 10118},
+    // zone 8
+    {14089, 11348}, {12944, 11138}, {13611, 12076}, {12499, 11722}, {13020, 12714},
+    {11964, 12221}, {12471, 13404}, {11464, 12768}, {11708, 13844}, {10893, 13262},
+    {10903, 14170}, {10127, 13371}, {10116, 14514}, {9489, 13799}, {9266, 14635},
+    {8732, 13791}, {8441, 15016}, {8000, 13902}, {7566, 14902}, {7274, 13747},
+    {6717, 14725}, {6551, 13643}, {5824, 14697}, {5842, 13451}, {5065, 14238},
+    {5224, 13050}, {4279, 13864}, {4556, 12740}, {3624, 13290}, {3895, 12372},
+    {3074, 12625}, {3442, 11770}, {2500, 11996}, {3140, 11084}, {2081, 11254},
+    {2670, 10508}, {1617, 10527}, {2343, 9838}, {1302, 9720}, {2094, 9127},
+    {1042, 8879}, {2085, 8372}, {1219, 8000}, {2275, 7640}, {1069, 7124},
+    {2249, 6903}, {1395, 6304}, {2292, 6145}, {1546, 5445}, {2806, 5556},
+    {2010, 4707}, {3087, 4882}, {2347, 3893}, {3430, 4219}, {2916, 3226},
+    {4000, 3741}, {3600, 2682}, {4490, 3169}, {4318, 2198}, {5212, 2929},
+    {5117, 1874}, {5849, 2566}, {5878, 1468}, {6515, 2216}, {6709, 1232},
+    {7261, 2147}, {7561, 1024}, {8000, 1978}, {8429, 1181}, {8721, 2296},
+    {9273, 1327}, {9480, 2235}, {10138, 1419}, {10180, 2493}, {10924, 1787},
+    {10890, 2744}, {11749, 2092}, {11509, 3170}, {12392, 2691}, {12002, 3738},
+    {13104, 3207}, {12629, 4170}, {13601, 3931}, {13029, 4809}, {13986, 4709},
+    {13369, 5473}, {14299, 5506}, {13503, 6212}, {14822, 6248}, {13908, 6873},
+    {14907, 7127}, {13911, 7628}, {15041, 8000}, {13911, 8372}, {14703, 8847},
+    {13897, 9125}, {14576, 9688}, {13583, 9814}, {14509, 10577}, {13201, 10447},
+    // zone 9
+    {13942, 11771}, {12698, 11413}, {13323, 12403}, {12330, 12066}, {12675, 12978},
+    {11714, 12490}, {12032, 13550}, {11093, 12873}, {11298, 13998}, {10434, 13172},
+    {10520, 14364}, {9797, 13529}, {9702, 14627}, {9072, 13619}, {8854, 14757},
+    {8370, 13874}, {8000, 15068}, {7632, 13848}, {7129, 14898}, {6910, 13713},
+    {6308, 14591}, {6206, 13523}, {5419, 14518}, {5516, 13279}, {4673, 14051},
+    {4834, 12989}, {3902, 13640}, {4225, 12563}, {3307, 12998}, {3637, 12097},
+    {2680, 12401}, {3279, 11430}, {2217, 11670}, {2779, 10870}, {1757, 10938},
+    {2613, 10133}, {1275, 10185}, {2259, 9474}, {1217, 9294}, {2113, 8744},
+    {1048, 8437}, {2041, 8000}, {1170, 7570}, {2255, 7274}, {1085, 6681},
+    {2241, 6521}, {1540, 5901}, {2555, 5844}, {1704, 5037}, {2776, 5128},
+    {2134, 4278}, {3231, 4535}, {2741, 3650}, {3839, 4093}, {3194, 2883},
+    {4238, 3452}, {3966, 2448}, {4864, 3059}, {4678, 1957}, {5495, 2676},
+    {5480, 1635}, {6158, 2330}, {6289, 1335}, {6892, 2191}, {7131, 1122},
+    {7638, 2245}, {8000, 1030}, {8366, 2188}, {8877, 1059}, {9117, 2145},
+    {9735, 1243}, {9830, 2369}, {10590, 1457}, {10549, 2583}, {11326, 1950},
+    {11188, 2976}, {11992, 2506}, {11764, 3450}, {12751, 2940}, {12285, 3976},
+    {13246, 3660}, {12704, 4583}, {13744, 4355}, {13104, 5194}, {14296, 5037},
+    {13378, 5871}, {14491, 5891}, {13785, 6515}, {14739, 6714}, {13886, 7256},
+    {15006, 7559}, {13730, 8000}, {14871, 8432}, {13926, 8749}, {14864, 9309},
+    {13690, 9461}, {14463, 10100}, {13384, 10132}, {14401, 11012}, {13029, 10765},
+    // zone 10
+    {13551, 12033}, {12868, 12027}, {13006, 12701}, {12441, 12730}, {12506, 13447},
+    {11714, 13111}, {11744, 13899}, {11109, 13655}, {10917, 14199}, {10364, 13970},
+    {10163, 14657}, {9561, 14080}, {9322, 14930}, {8805, 14374}, {8431, 14850},
+    {8000, 14296}, {7553, 15101}, {7223, 14152}, {6720, 14712}, {6457, 14011},
+    {5829, 14682}, {5642, 13955}, {5008, 14357}, {4967, 13516}, {4245, 13916},
+    {4303, 13089}, {3504, 13435}, {3738, 12539}, {2846, 12840}, {3223, 11952},
+    {2335, 12116}, {2656, 11391}, {2018, 11288}, {2309, 10678}, {1412, 10609},
+    {1914, 9977}, {1324, 9714}, {1817, 9179}, {968, 8888}, {1611, 8402},
+    {880, 8000}, {1699, 7604}, {1180, 7138}, {1721, 6802}, {1114, 6232},
+    {1986, 6046}, {1486, 5421}, {2128, 5237}, {1818, 4601}, {2660, 4611},
+    {2330, 3881}, {3048, 3903}, {2820, 3136}, {3653, 3371}, {3579, 2656},
+    {4298, 2905}, {4335, 2226}, {4996, 2535}, {5011, 1649}, {5685, 2153},
+    {5804, 1243}, {6399, 1764}, {6721, 1294}, {7202, 1684}, {7563, 1052},
+    {8000, 1580}, {8441, 998}, {8807, 1613}, {9310, 1135}, {9551, 1961},
+    {10120, 1476}, {10370, 2015}, {10966, 1697}, {11039, 2471}, {11803, 2007},
+    {11659, 2964}, {12445, 2627}, {12393, 3321}, {13038, 3269}, {12989, 3873},
+    {13708, 3853}, {13254, 4666}, {14130, 4630}, {13856, 5244}, {14597, 5388},
+    {14159, 5999}, {14704, 6279}, {14286, 6801}, {15027, 7112}, {14326, 7602},
+    {14851, 8000}, {14287, 8396}, {14841, 8864}, {14359, 9213}, {14666, 9711},
+    {14005, 9951}, {14381, 10526}, {13627, 10648}, {14202, 11410}, {13332, 11384},
+    // zone 11
+    {13174, 12280}, {12367, 12100}, {12485, 12776}, {11721, 12498}, {11802, 13234},
+    {11207, 13053}, {11119, 13673}, {10532, 13380}, {10424, 14122}, {9790, 13509},
+    {9668, 14498}, {9107, 13804}, {8840, 14652}, {8378, 14008}, {8000, 14461},
+    {7636, 13783}, {7183, 14467}, {6891, 13813}, {6383, 14300}, {6177, 13609},
+    {5555, 14177}, {5478, 13360}, {4776, 13865}, {4782, 13071}, {4050, 13437},
+    {4267, 12513}, {3523, 12767}, {3789, 11955}, {2898, 12220}, {3118, 11547},
+    {2303, 11615}, {2881, 10814}, {2072, 10789}, {2442, 10201}, {1728, 10038},
+    {2214, 9486}, {1563, 9228}, {2230, 8729}, {1392, 8416}, {2117, 8000},
+    {1262, 7576}, {2139, 7260}, {1607, 6781}, {2343, 6548}, {1596, 5919},
+    {2577, 5853}, {2089, 5218}, {2734, 5105}, {2407, 4451}, {3238, 4540},
+    {2883, 3767}, {3749, 4008}, {3500, 3208}, {4195, 3400}, {4125, 2667},
+    {4801, 2959}, {4880, 2324}, {5462, 2606}, {5548, 1806}, {6132, 2251},
+    {6353, 1587}, {6873, 2094}, {7191, 1593}, {7633, 2175}, {8000, 1426},
+    {8364, 2212}, {8824, 1475}, {9134, 2055}, {9669, 1500}, {9818, 2404},
+    {10386, 1974}, {10548, 2585}, {11142, 2284}, {11216, 2932}, {11956, 2555},
+    {11731, 3490}, {12547, 3157}, {12366, 3900}, {13136, 3751}, {12852, 4475},
+    {13703, 4381}, {13232, 5124}, {14008, 5173}, {13607, 5780}, {14416, 5915},
+    {13818, 6506}, {14414, 6776}, {13976, 7245}, {14499, 7591}, {13836, 8000},
+    {14600, 8415}, {13852, 8739}, {14551, 9250}, {13863, 9505}, {14307, 10049},
+    {13432, 10151}, {13975, 10812}, {13213, 10866}, {13696, 11615}, {12681, 11401},
+    // zone 12
+    {12916, 12617}, {12087, 12352}, {12317, 13218}, {11473, 12780}, {11584, 13647},
+    {10812, 13116}, {10784, 13917}, {10163, 13463}, {10069, 14366}, {9458, 13677},
+    {9253, 14570}, {8746, 13906}, {8413, 14567}, {8000, 14033}, {7579, 14697},
+    {7272, 13761}, {6737, 14622}, {6541, 13682}, {5943, 14332}, {5863, 13397},
+    {5169, 14017}, {5176, 13136}, {4380, 13704}, {4585, 12700}, {3680, 13222},
+    {3956, 12306}, {3223, 12486}, {3333, 11861}, {2716, 11839}, {3080, 11122},
+    {2102, 11242}, {2695, 10496}, {1771, 10466}, {2480, 9794}, {1445, 9683},
+    {2077, 9130}, {1301, 8846}, {2156, 8368}, {1369, 8000}, {2092, 7628},
+    {1362, 7161}, {2276, 6908}, {1572, 6350}, {2260, 6135}, {1722, 5514},
+    {2694, 5503}, {2138, 4777}, {2960, 4802}, {2551, 4041}, {3506, 4283},
+    {3199, 3492}, {3981, 3720}, {3736, 2846}, {4510, 3196}, {4417, 2355},
+    {5092, 2711}, {5187, 2023}, {5782, 2397}, {5908, 1561}, {6546, 2339},
+    {6732, 1351}, {7271, 2232}, {7586, 1420}, {8000, 2044}, {8420, 1320},
+    {8742, 2124}, {9270, 1344}, {9438, 2398}, {10013, 1806}, {10218, 2398},
+    {10879, 1882}, {10813, 2882}, {11514, 2462}, {11476, 3215}, {12289, 2816},
+    {11980, 3762}, {12889, 3409}, {12533, 4250}, {13362, 4104}, {12905, 4887},
+    {13848, 4785}, {13237, 5536}, {14189, 5550}, {13603, 6180}, {14315, 6379},
+    {13842, 6886}, {14502, 7179}, {13963, 7625}, {14785, 8000}, {14003, 8378},
+    {14457, 8816}, {13685, 9085}, {14512, 9672}, {13530, 9797}, {14187, 10450},
+    {13365, 10524}, {13928, 11259}, {12920, 11122}, {13327, 11871}, {12578, 11787},
+    // zone 13
+    {12523, 12817}, {11752, 12535}, {12015, 13526}, {11204, 13049}, {11195, 13811},
+    {10535, 13386}, {10467, 14230}, {9832, 13639}, {9646, 14411}, {9121, 13879},
+    {8842, 14663}, {8368, 13852}, {8000, 14560}, {7622, 14011}, {7150, 14727},
+    {6885, 13844}, {6341, 14459}, {6178, 13607}, {5548, 14192}, {5546, 13215},
+    {4749, 13914}, {4877, 12922}, {4110, 13354}, {4188, 12608}, {3460, 12835},
+    {3689, 12048}, {2777, 12321}, {3115, 11549}, {2347, 11587}, {2869, 10821},
+    {1852, 10893}, {2406, 10215}, {1542, 10098}, {2275, 9470}, {1545, 9231},
+    {2228, 8729}, {1476, 8410}, {1975, 8000}, {1410, 7585}, {2268, 7276},
+    {1387, 6739}, {2153, 6499}, {1551, 5905}, {2418, 5790}, {2033, 5192},
+    {2899, 5196}, {2445, 4475}, {3274, 4566}, {2774, 3676}, {3686, 3949},
+    {3424, 3128}, {4156, 3353}, {4101, 2634}, {4772, 2913}, {4720, 2034},
+    {5498, 2683}, {5531, 1763}, {6172, 2373}, {6367, 1640}, {6919, 2332},
+    {7152, 1289}, {7639, 2267}, {8000, 1290}, {8373, 2072}, {8847, 1296},
+    {9086, 2308}, {9672, 1486}, {9786, 2505}, {10439, 1840}, {10517, 2652},
+    {11234, 2116}, {11230, 2910}, {11929, 2593}, {11689, 3541}, {12556, 3149},
+    {12221, 4036}, {13083, 3795}, {12712, 4577}, {13663, 4406}, {13154, 5166},
+    {14108, 5126}, {13367, 5875}, {14385, 5925}, {13800, 6511}, {14620, 6737},
+    {13915, 7253}, {14602, 7585}, {13900, 8000}, {14692, 8421}, {13964, 8753},
+    {14701, 9278}, {13823, 9495}, {14247, 10030}, {13519, 10185}, {14125, 10882},
+    {13262, 10893}, {13535, 11512}, {12676, 11397}, {13193, 12296}, {12254, 11994},
+    // zone 14
+    {12240, 13125}, {11378, 12649}, {11661, 13769}, {10822, 13133}, {10873, 14106},
+    {10176, 13497}, {10076, 14388}, {9473, 13739}, {9235, 14476}, {8755, 13976},
+    {8426, 14773}, {8000, 13796}, {7580, 14682}, {7248, 13951}, {6719, 14713},
+    {6547, 13657}, {5906, 14445}, {5828, 13486}, {5083, 14198}, {5140, 13203},
+    {4431, 13623}, {4587, 12698}, {3731, 13160}, {3975, 12286}, {3032, 12665},
+    {3437, 11775}, {2678, 11866}, {3086, 11119}, {2086, 11251}, {2783, 10455},
+    {1820, 10447}, {2543, 9773}, {1541, 9658}, {2136, 9119}, {1436, 8829},
+    {2056, 8374}, {1386, 8000}, {2053, 7626}, {1423, 7169}, {2306, 6914},
+    {1602, 6357}, {2473, 6204}, {1772, 5534}, {2549, 5435}, {2074, 4742},
+    {2972, 4809}, {2652, 4115}, {3506, 4282}, {3114, 3411}, {3926, 3662},
+    {3774, 2891}, {4570, 3279}, {4445, 2399}, {5112, 2747}, {5114, 1868},
+    {5796, 2434}, {5897, 1527}, {6509, 2194}, {6724, 1312}, {7278, 2288},
+    {7578, 1289}, {8000, 2273}, {8415, 1401}, {8736, 2171}, {9264, 1372},
+    {9471, 2270}, {10072, 1622}, {10203, 2436}, {10819, 2009}, {10772, 2958},
+    {11623, 2291}, {11371, 3360}, {12322, 2776}, {11992, 3749}, {12999, 3305},
+    {12482, 4292}, {13534, 3979}, {13053, 4793}, {13844, 4787}, {13291, 5510},
+    {14316, 5499}, {13637, 6168}, {14496, 6332}, {13756, 6902}, {14677, 7157},
+    {13778, 7637}, {14602, 8000}, {14014, 8378}, {14609, 8835}, {13744, 9096},
+    {14641, 9705}, {13613, 9824}, {14147, 10434}, {13219, 10456}, {14009, 11303},
+    {13000, 11173}, {13446, 11957}, {12616, 11819}, {12793, 12501}, {11988, 12247},
+    // zone 15
+    {11960, 13451}, {11164, 12985}, {11217, 13851}, {10516, 13347}, {10490, 14289},
+    {9786, 13496}, {9703, 14633}, {9115, 13843}, {8834, 14599}, {8364, 13792},
+    {8000, 14828}, {7623, 13993}, {7163, 14627}, {6923, 13643}, {6321, 14538},
+    {6227, 13458}, {5522, 14259}, {5539, 13231}, {4695, 14012}, {4845, 12972},
+    {4054, 13431}, {4218, 12571}, {3317, 12987}, {3622, 12111}, {2781, 12317},
+    {3212, 11479}, {2346, 11588}, {2789, 10865}, {1839, 10899}, {2434, 10204},
+    {1482, 10118}, {2460, 9423}, {1511, 9238}, {2160, 8738}, {1188, 8429},
+    {2076, 8000}, {1208, 7573}, {2292, 7279}, {1260, 6714}, {2435, 6571},
+    {1497, 5887}, {2418, 5790}, {1991, 5172}, {2861, 5175}, {2389, 4439},
+    {3170, 4491}, {2808, 3704}, {3798, 4054}, {3345, 3043}, {4342, 3578},
+    {4107, 2642}, {4785, 2933}, {4707, 2010}, {5470, 2623}, {5463, 1593},
+    {6167, 2359}, {6348, 1566}, {6888, 2172}, {7156, 1318}, {7629, 2110},
+    {8000, 1137}, {8373, 2070}, {8831, 1423}, {9108, 2192}, {9707, 1354},
+    {9779, 2525}, {10507, 1668}, {10459, 2775}, {11213, 2156}, {11108, 3102},
+    {11982, 2519}, {11701, 3526}, {12612, 3088}, {12231, 4027}, {13176, 3718},
+    {12795, 4516}, {13774, 4335}, {13056, 5220}, {14138, 5112}, {13571, 5794},
+    {14452, 5904}, {13723, 6530}, {14648, 6732}, {13881, 7257}, {14710, 7578},
+    {13930, 8000}, {14602, 8415}, {13859, 8740}, {14683, 9275}, {13758, 9478},
+    {14446, 10095}, {13423, 10147}, {14104, 10872}, {13131, 10821}, {13806, 11685},
+    {12626, 11361}, {13304, 12388}, {12350, 12085}, {12548, 12843}, {11804, 12598},
+    // zone 16
+    {11660, 13768}, {10758, 13016}, {10888, 14137}, {10132, 13385}, {10092, 14440},
+    {9443, 13620}, {9296, 14793}, {8718, 13687}, {8428, 14802}, {8000, 13816},
+    {7581, 14654}, {7249, 13945}, {6750, 14551}, {6518, 13774}, {5863, 14578},
+    {5819, 13508}, {5157, 14042}, {5232, 13034}, {4439, 13611}, {4546, 12754},
+    {3690, 13209}, {4088, 12165}, {2985, 12709}, {3590, 11649}, {2483, 12009},
+    {3171, 11064}, {2010, 11293}, {2649, 10518}, {1608, 10531}, {2410, 9816},
+    {1487, 9672}, {2183, 9110}, {1195, 8860}, {2087, 8372}, {1213, 8000},
+    {2235, 7637}, {1325, 7157}, {2284, 6910}, {1345, 6291}, {2573, 6237},
+    {1697, 5504}, {2817, 5561}, {1972, 4686}, {3063, 4867}, {2449, 3967},
+    {3537, 4308}, {2987, 3292}, {3939, 3675}, {3664, 2759}, {4597, 3316},
+    {4318, 2198}, {5112, 2747}, {5168, 1982}, {5818, 2490}, {5860, 1414},
+    {6559, 2387}, {6709, 1230}, {7257, 2116}, {7582, 1359}, {8000, 2211},
+    {8424, 1257}, {8723, 2274}, {9261, 1389}, {9443, 2379}, {10099, 1539},
+    {10174, 2510}, {10927, 1779}, {10841, 2832}, {11561, 2389}, {11500, 3182},
+    {12290, 2814}, {12050, 3687}, {12996, 3309}, {12607, 4189}, {13494, 4008},
+    {12861, 4915}, {13969, 4718}, {13273, 5519}, {14334, 5492}, {13695, 6150},
+    {14549, 6319}, {13717, 6909}, {14808, 7140}, {13819, 7634}, {14802, 8000},
+    {13830, 8367}, {14856, 8866}, {13706, 9088}, {14575, 9688}, {13649, 9836},
+    {14340, 10510}, {13293, 10491}, {13955, 11274}, {13036, 11196}, {13539, 12025},
+    {12556, 11769}, {12881, 12584}, {11996, 12255}, {12280, 13174}, {11482, 12793},
+    // zone 17
+    {11273, 13954}, {10441, 13188}, {10535, 14403}, {9845, 13677}, {9708, 14652},
+    {9114, 13838}, {8864, 14841}, {8357, 13673}, {8000, 14853}, {7641, 13709},
+    {7150, 14727}, {6902, 13757}, {6326, 14520}, {6226, 13460}, {5438, 14470},
+    {5478, 13360}, {4689, 14022}, {4944, 12815}, {3902, 13640}, {4229, 12558},
+    {3350, 12952}, {3776, 11967}, {2699, 12385}, {3172, 11508}, {2308, 11612},
+    {2967, 10767}, {1841, 10898}, {2613, 10133}, {1514, 10107}, {2403, 9437},
+    {1238, 9290}, {2073, 8749}, {1054, 8437}, {2190, 8000}, {1299, 7578},
+    {2140, 7260}, {1321, 6726}, {2387, 6559}, {1397, 5854}, {2510, 5826},
+    {1813, 5089}, {2922, 5208}, {2237, 4342}, {3217, 4525}, {2771, 3674},
+    {3764, 4022}, {3372, 3071}, {4291, 3516}, {4037, 2546}, {4907, 3126},
+    {4659, 1923}, {5507, 2703}, {5446, 1549}, {6239, 2581}, {6272, 1270},
+    {6928, 2379}, {7139, 1188}, {7631, 2137}, {8000, 1125}, {8359, 2287},
+    {8867, 1138}, {9066, 2414}, {9695, 1398}, {9816, 2411}, {10477, 1744},
+    {10495, 2697}, {11346, 1914}, {11143, 3047}, {12053, 2422}, {11738, 3482},
+    {12701, 2993}, {12197, 4058}, {13330, 3591}, {12698, 4587}, {13824, 4304},
+    {13162, 5162}, {14170, 5097}, {13520, 5814}, {14469, 5898}, {13501, 6588},
+    {14669, 6728}, {13799, 7267}, {14814, 7571}, {13904, 8000}, {14709, 8422},
+    {13907, 8746}, {14794, 9296}, {13680, 9458}, {14593, 10142}, {13301, 10099},
+    {14084, 10863}, {13149, 10831}, {13748, 11648}, {12629, 11363}, {13223, 12321},
+    {12358, 12092}, {12710, 13016}, {11798, 12591}, {11978, 13475}, {11181, 13012},
+    // zone 18
+    {10983, 14340}, {10146, 13420}, {10124, 14536}, {9480, 13763}, {9287, 14748},
+    {8744, 13892}, {8439, 14977}, {8000, 13889}, {7565, 14912}, {7257, 13885},
+    {6729, 14663}, {6537, 13698}, {5892, 14487}, {5814, 13520}, {5094, 14175},
+    {5191, 13110}, {4301, 13829}, {4552, 12746}, {3537, 13394}, {3959, 12303},
+    {3051, 12647}, {3498, 11724}, {2401, 12068}, {3056, 11138}, {1890, 11359},
+    {2800, 10447}, {1716, 10488}, {2593, 9757}, {1204, 9745}, {2169, 9112},
+    {1196, 8860}, {2184, 8366}, {1013, 8000}, {2143, 7631}, {1087, 7127},
+    {2404, 6932}, {1461, 6321}, {2537, 6225}, {1648, 5485}, {2679, 5496},
+    {2037, 4722}, {3182, 4943}, {2364, 3905}, {3556, 4323}, {3067, 3368},
+    {4069, 3814}, {3706, 2810}, {4624, 3354}, {4310, 2185}, {5187, 2883},
+    {5139, 1920}, {5897, 2687}, {5897, 1527}, {6547, 2340}, {6713, 1255},
+    {7272, 2234}, {7574, 1231}, {8000, 2278}, {8430, 1160}, {8723, 2274},
+    {9284, 1266}, {9430, 2432}, {10076, 1610}, {10096, 2707}, {10918, 1798},
+    {10778, 2947}, {11670, 2216}, {11488, 3199}, {12467, 2600}, {11977, 3765},
+    {13110, 3201}, {12381, 4376}, {13600, 3931}, {12960, 4853}, {14083, 4656},
+    {13149, 5577}, {14324, 5496}, {13455, 6227}, {14661, 6290}, {13633, 6925},
+    {14890, 7130}, {13722, 7640}, {14780, 8000}, {13727, 8360}, {14693, 8845},
+    {13724, 9092}, {14655, 9709}, {13451, 9771}, {14402, 10535}, {13305, 10496},
+    {14082, 11343}, {13003, 11175}, {13674, 12122}, {12380, 11624}, {13079, 12769},
+    {11985, 12244}, {12334, 13239}, {11451, 12751}, {11748, 13906}, {10781, 13058},
+    // zone 19
+    {10547, 14432}, {9976, 14082}, {9742, 14783}, {9183, 14199}, {8883, 14993},
+    {8386, 14139}, {8000, 14974}, {7603, 14310}, {7144, 14779}, {6845, 14056},
+    {6295, 14642}, {6071, 13937}, {5419, 14518}, {5357, 13616}, {4698, 14007},
+    {4662, 13259}, {3911, 13628}, {3894, 12963}, {3321, 12983}, {3342, 12374},
+    {2737, 12354}, {2955, 11665}, {2246, 11652}, {2394, 11082}, {1768, 10933},
+    {2183, 10303}, {1430, 10135}, {2001, 9540}, {1265, 9285}, {1728, 8792},
+    {1027, 8439}, {1575, 8000}, {1130, 7568}, {1814, 7219}, {1344, 6730},
+    {1997, 6459}, {1338, 5835}, {2045, 5642}, {1816, 5090}, {2355, 4897},
+    {2227, 4337}, {3021, 4383}, {2743, 3651}, {3488, 3763}, {3271, 2964},
+    {4035, 3207}, {3987, 2476}, {4569, 2593}, {4723, 2039}, {5378, 2427},
+    {5461, 1586}, {6068, 2055}, {6304, 1395}, {6837, 1902}, {7149, 1267},
+    {7611, 1813}, {8000, 1149}, {8395, 1714}, {8857, 1219}, {9157, 1932},
+    {9718, 1310}, {9932, 2055}, {10529, 1613}, {10667, 2332}, {11325, 1952},
+    {11428, 2599}, {12086, 2376}, {11974, 3196}, {12743, 2949}, {12630, 3652},
+    {13377, 3551}, {12974, 4386}, {13730, 4363}, {13480, 4987}, {14175, 5094},
+    {13799, 5704}, {14550, 5872}, {14238, 6398}, {14693, 6723}, {14393, 7192},
+    {15035, 7557}, {14437, 8000}, {14889, 8433}, {14320, 8798}, {14646, 9268},
+    {14053, 9554}, {14558, 10131}, {13777, 10287}, {14166, 10902}, {13412, 10975},
+    {13824, 11696}, {13080, 11691}, {13280, 12368}, {12555, 12278}, {12804, 13116},
+    {12099, 12954}, {12063, 13593}, {11448, 13433}, {11328, 14054}, {10687, 13709},
+    // zone 20
+    {10107, 14483}, {9583, 14164}, {9279, 14707}, {8784, 14204}, {8436, 14925},
+    {8000, 14144}, {7563, 14946}, {7218, 14190}, {6679, 14927}, {6402, 14223},
+    {5822, 14704}, {5701, 13807}, {5067, 14232}, {4917, 13608}, {4255, 13902},
+    {4392, 12967}, {3634, 13277}, {3770, 12504}, {3044, 12654}, {3121, 12036},
+    {2315, 12130}, {2779, 11314}, {1961, 11320}, {2394, 10638}, {1489, 10578},
+    {2050, 9933}, {1291, 9723}, {1836, 9176}, {1228, 8856}, {1646, 8400},
+    {1141, 8000}, {1876, 7615}, {1240, 7146}, {1949, 6846}, {1301, 6280},
+    {1932, 6028}, {1661, 5490}, {2229, 5284}, {1990, 4696}, {2609, 4579},
+    {2375, 3913}, {3151, 3989}, {3025, 3328}, {3640, 3357}, {3513, 2576},
+    {4265, 2860}, {4233, 2064}, {5042, 2619}, {4982, 1587}, {5710, 2216},
+    {5879, 1473}, {6405, 1789}, {6725, 1317}, {7218, 1813}, {7564, 1072},
+    {8000, 1737}, {8428, 1203}, {8779, 1837}, {9312, 1122}, {9546, 1979},
+    {10156, 1364}, {10314, 2156}, {10937, 1758}, {11042, 2466}, {11714, 2148},
+    {11713, 2889}, {12435, 2639}, {12291, 3430}, {12955, 3347}, {12728, 4089},
+    {13507, 3999}, {13281, 4648}, {14144, 4622}, {13802, 5270}, {14340, 5490},
+    {13837, 6104}, {14789, 6257}, {14316, 6795}, {14803, 7141}, {14332, 7602},
+    {14874, 8000}, {14336, 8399}, {14736, 8851}, {14262, 9195}, {14839, 9756},
+    {13924, 9925}, {14542, 10590}, {13614, 10642}, {14135, 11373}, {13244, 11328},
+    {13645, 12102}, {12766, 11942}, {12950, 12648}, {12285, 12563}, {12354, 13263},
+    {11636, 13005}, {11778, 13953}, {11022, 13497}, {10938, 14244}, {10316, 13848},
+    // zone 21
+    {9698, 14613}, {9195, 14266}, {8889, 15035}, {8394, 14258}, {8000, 15004},
+    {7611, 14187}, {7113, 15023}, {6812, 14228}, {6249, 14821}, {6026, 14074},
+    {5444, 14455}, {5291, 13757}, {4600, 14184}, {4712, 13182}, {3915, 13623},
+    {4044, 12782}, {3284, 13022}, {3493, 12233}, {2720, 12368}, {2914, 11695},
+    {2170, 11700}, {2525, 11010}, {1655, 10986}, {2304, 10255}, {1413, 10140},
+    {1959, 9551}, {1024, 9331}, {1769, 8787}, {965, 8443}, {1644, 8000},
+    {1164, 7570}, {1888, 7228}, {1235, 6710}, {1814, 6412}, {1462, 5876},
+    {2155, 5686}, {1706, 5038}, {2412, 4928}, {1999, 4192}, {2922, 4310},
+    {2565, 3504}, {3364, 3647}, {3312, 3008}, {4021, 3190}, {3955, 2433},
+    {4697, 2796}, {4569, 1759}, {5380, 2432}, {5457, 1577}, {6024, 1917},
+    {6257, 1211}, {6837, 1901}, {7135, 1151}, {7603, 1694}, {8000, 1132},
+    {8399, 1664}, {8892, 940}, {9160, 1920}, {9752, 1176}, {9952, 1992},
+    {10596, 1443}, {10701, 2261}, {11334, 1936}, {11383, 2670}, {12170, 2261},
+    {11902, 3283}, {12745, 2947}, {12666, 3618}, {13403, 3530}, {12946, 4406},
+    {13776, 4334}, {13447, 5005}, {14290, 5040}, {13957, 5641}, {14743, 5809},
+    {13980, 6465}, {14888, 6686}, {14307, 7203}, {14900, 7566}, {14284, 8000},
+    {14863, 8432}, {14141, 8776}, {14899, 9316}, {14019, 9545}, {14650, 10161},
+    {13829, 10308}, {14284, 10957}, {13500, 11023}, {13855, 11715}, {12950, 11596},
+    {13393, 12461}, {12484, 12211}, {12794, 13105}, {12024, 12864}, {12030, 13547},
+    {11397, 13353}, {11305, 14012}, {10636, 13601}, {10575, 14504}, {9906, 13865},
+    // zone 22
+    {9250, 14554}, {8725, 13742}, {8420, 14677}, {8000, 13838}, {7577, 14717},
+    {7283, 13673}, {6739, 14608}, {6524, 13748}, {5923, 14392}, {5866, 13390},
+    {5186, 13980}, {5123, 13233}, {4496, 13522}, {4550, 12749}, {3753, 13134},
+    {3972, 12289}, {3133, 12571}, {3569, 11666}, {2613, 11914}, {2980, 11186},
+    {2138, 11222}, {2844, 10426}, {1727, 10484}, {2357, 9833}, {1702, 9617},
+    {2157, 9115}, {1378, 8837}, {2257, 8361}, {1373, 8000}, {2057, 7626},
+    {1326, 7157}, {2242, 6902}, {1670, 6375}, {2320, 6155}, {1755, 5527},
+    {2629, 5473}, {2130, 4773}, {3095, 4887}, {2697, 4147}, {3580, 4343},
+    {3243, 3533}, {4054, 3797}, {3827, 2955}, {4556, 3260}, {4376, 2290},
+    {5129, 2778}, {5221, 2094}, {5796, 2433}, {5926, 1618}, {6542, 2320},
+    {6747, 1431}, {7260, 2139}, {7579, 1303}, {8000, 2068}, {8415, 1407},
+    {8720, 2301}, {9218, 1617}, {9462, 2305}, {10055, 1675}, {10126, 2630},
+    {10787, 2078}, {10747, 3002}, {11524, 2448}, {11437, 3269}, {12123, 3016},
+    {11998, 3742}, {12717, 3570}, {12521, 4260}, {13310, 4142}, {12955, 4856},
+    {13720, 4856}, {13376, 5470}, {14246, 5527}, {13654, 6163}, {14393, 6359},
+    {13601, 6932}, {14650, 7160}, {13950, 7626}, {14574, 8000}, {13771, 8363},
+    {14609, 8835}, {13757, 9098}, {14378, 9638}, {13639, 9832}, {14062, 10400},
+    {13427, 10554}, {13829, 11205}, {12909, 11115}, {13427, 11943}, {12463, 11692},
+    {12767, 12477}, {12036, 12298}, {12155, 13022}, {11501, 12819}, {11534, 13569},
+    {10784, 13064}, {10814, 13980}, {10150, 13431}, {10065, 14357}, {9448, 13640},
+    // zone 23
+    {8849, 14717}, {8365, 13804}, {8000, 14589}, {7633, 13827}, {7149, 14735},
+    {6919, 13669}, {6382, 14304}, {6232, 13441}, {5569, 14139}, {5548, 13211},
+    {4745, 13920}, {4909, 12871}, {4084, 13390}, {4305, 12466}, {3494, 12799},
+    {3854, 11894}, {2855, 12256}, {3224, 11470}, {2297, 11620}, {2870, 10820},
+    {2115, 10769}, {2540, 10162}, {1656, 10061}, {2222, 9483}, {1440, 9251},
+    {2090, 8747}, {1475, 8411}, {2302, 8000}, {1273, 7577}, {2192, 7266},
+    {1524, 6765}, {2247, 6523}, {1603, 5922}, {2662, 5887}, {1961, 5158},
+    {2773, 5126}, {2273, 4365}, {3283, 4573}, {2858, 3746}, {3773, 4031},
+    {3533, 3243}, {4297, 3524}, {4175, 2736}, {4820, 2990}, {4828, 2230},
+    {5563, 2822}, {5601, 1940}, {6152, 2313}, {6319, 1454}, {6927, 2373},
+    {7152, 1286}, {7628, 2094}, {8000, 1389}, {8368, 2158}, {8824, 1474},
+    {9086, 2306}, {9649, 1578}, {9799, 2462}, {10461, 1784}, {10442, 2810},
+    {11248, 2093}, {11112, 3096}, {11965, 2542}, {11707, 3519}, {12475, 3235},
+    {12315, 3948}, {13060, 3814}, {12766, 4537}, {13581, 4458}, {13223, 5129},
+    {14134, 5114}, {13283, 5908}, {14211, 5982}, {13513, 6584}, {14506, 6759},
+    {13806, 7267}, {14613, 7584}, {13901, 8000}, {14696, 8421}, {13763, 8728},
+    {14665, 9271}, {13650, 9451}, {14467, 10101}, {13437, 10153}, {14032, 10838},
+    {13064, 10784}, {13641, 11580}, {12752, 11453}, {13103, 12222}, {12303, 12041},
+    {12504, 12796}, {11802, 12596}, {11974, 13470}, {11182, 13014}, {11166, 13758},
+    {10477, 13264}, {10431, 14141}, {9780, 13479}, {9670, 14505}, {9077, 13643},
+    // zone 24
+    {8426, 14779}, {8000, 13900}, {7584, 14612}, {7287, 13640}, {6762, 14491},
+    {6589, 13494}, {5964, 14267}, {5906, 13289}, {5195, 13960}, {5163, 13160},
+    {4386, 13694}, {4532, 12773}, {3690, 13210}, {3993, 12267}, {3036, 12661},
+    {3589, 11649}, {2647, 11889}, {3156, 11074}, {2071, 11260}, {2625, 10529},
+    {1781, 10462}, {2464, 9799}, {1603, 9642}, {2360, 9076}, {1349, 8840},
+    {2284, 8360}, {1332, 8000}, {2237, 7637}, {1400, 7166}, {2211, 6896},
+    {1561, 6347}, {2550, 6229}, {1918, 5592}, {2805, 5556}, {2194, 4808},
+    {3076, 4875}, {2646, 4110}, {3467, 4250}, {3166, 3461}, {4099, 3846},
+    {3814, 2940}, {4565, 3272}, {4399, 2325}, {5261, 3017}, {5140, 1922},
+    {5883, 2653}, {5966, 1739}, {6565, 2412}, {6724, 1310}, {7264, 2177},
+    {7577, 1282}, {8000, 2099}, {8426, 1231}, {8717, 2321}, {9242, 1487},
+    {9447, 2365}, {10078, 1604}, {10158, 2550}, {10808, 2032}, {10807, 2894},
+    {11601, 2326}, {11476, 3216}, {12224, 2894}, {11925, 3820}, {12843, 3452},
+    {12528, 4254}, {13481, 4018}, {13036, 4804}, {13799, 4812}, {13146, 5579},
+    {14299, 5506}, {13493, 6215}, {14474, 6338}, {13579, 6936}, {14768, 7145},
+    {13858, 7631}, {14669, 8000}, {13803, 8365}, {14618, 8836}, {13787, 9104},
+    {14401, 9644}, {13392, 9752}, {14093, 10412}, {13184, 10439}, {13781, 11178},
+    {12805, 11049}, {13449, 11959}, {12570, 11781}, {12770, 12480}, {11888, 12140},
+    {12331, 13235}, {11369, 12637}, {11641, 13738}, {10745, 12993}, {10797, 13945},
+    {10148, 13426}, {10041, 14283}, {9471, 13730}, {9274, 14677}, {8714, 13655},
+    // zone 25
+    {8000, 14745}, {7640, 13716}, {7161, 14642}, {6913, 13700}, {6343, 14454},
+    {6173, 13623}, {5499, 14317}, {5568, 13169}, {4713, 13979}, {4888, 12904},
+    {3996, 13511}, {4279, 12498}, {3355, 12946}, {3748, 11993}, {2812, 12292},
+    {3419, 11329}, {2413, 11546}, {2983, 10758}, {1857, 10891}, {2695, 10101},
+    {1636, 10068}, {2508, 9410}, {1299, 9278}, {2183, 8735}, {1165, 8430},
+    {2247, 8000}, {1170, 7570}, {2142, 7260}, {1490, 6758}, {2327, 6543},
+    {1650, 5937}, {2690, 5898}, {2019, 5186}, {2903, 5198}, {2301, 4383},
+    {3186, 4503}, {2932, 3808}, {3734, 3994}, {3483, 3190}, {4371, 3613},
+    {3972, 2457}, {4826, 2998}, {4757, 2101}, {5553, 2801}, {5569, 1860},
+    {6253, 2623}, {6364, 1629}, {6932, 2400}, {7149, 1261}, {7642, 2307},
+    {8000, 1152}, {8368, 2151}, {8833, 1407}, {9110, 2181}, {9666, 1511},
+    {9793, 2482}, {10511, 1658}, {10515, 2655}, {11177, 2222}, {11078, 3149},
+    {11970, 2535}, {11789, 3419}, {12695, 3000}, {12321, 3943}, {13216, 3685},
+    {12692, 4591}, {13745, 4354}, {13018, 5241}, {14170, 5097}, {13362, 5877},
+    {14491, 5891}, {13476, 6594}, {14607, 6740}, {13734, 7276}, {14802, 7572},
+    {13794, 8000}, {14592, 8415}, {13839, 8738}, {14510, 9242}, {13479, 9407},
+    {14391, 10077}, {13379, 10130}, {14175, 10906}, {13038, 10770}, {13613, 11562},
+    {12718, 11428}, {13223, 12320}, {12264, 12005}, {12619, 12918}, {11771, 12558},
+    {11866, 13321}, {11110, 12901}, {11181, 13786}, {10482, 13275}, {10528, 14384},
+    {9822, 13606}, {9659, 14462}, {9108, 13808}, {8837, 14627}, {8358, 13690},
+    // zone 26
+    {7583, 14621}, {7257, 13880}, {6729, 14664}, {6570, 13571}, {5884, 14511},
+    {5820, 13507}, {5153, 14050}, {5207, 13081}, {4446, 13600}, {4607, 12670},
+    {3639, 13271}, {4022, 12236}, {3023, 12673}, {3453, 11761}, {2517, 11983},
+    {3216, 11036}, {1949, 11327}, {2671, 10508}, {1745, 10476}, {2562, 9767},
+    {1466, 9678}, {2191, 9108}, {1359, 8839}, {2091, 8372}, {1201, 8000},
+    {2249, 7638}, {1409, 7167}, {2427, 6937}, {1377, 6299}, {2483, 6207},
+    {1739, 5521}, {2696, 5504}, {2154, 4786}, {3231, 4974}, {2582, 4064},
+    {3489, 4268}, {3017, 3320}, {4015, 3757}, {3660, 2754}, {4585, 3300},
+    {4368, 2276}, {5149, 2814}, {5110, 1858}, {5882, 2651}, {5941, 1662},
+    {6543, 2324}, {6708, 1226}, {7293, 2401}, {7578, 1300}, {8000, 2360},
+    {8419, 1335}, {8738, 2160}, {9257, 1413}, {9470, 2276}, {10094, 1555},
+    {10140, 2595}, {10921, 1793}, {10815, 2880}, {11588, 2346}, {11374, 3356},
+    {12308, 2793}, {11859, 3891}, {13034, 3273}, {12535, 4248}, {13577, 3948},
+    {12986, 4836}, {14016, 4693}, {13109, 5596}, {14148, 5566}, {13538, 6201},
+    {14587, 6309}, {13820, 6890}, {14849, 7135}, {13712, 7641}, {14768, 8000},
+    {13730, 8360}, {14673, 8843}, {13597, 9068}, {14470, 9661}, {13379, 9748},
+    {14177, 10445}, {13279, 10484}, {13821, 11200}, {12805, 11049}, {13511, 12004},
+    {12461, 11690}, {12898, 12599}, {12037, 12299}, {12319, 13221}, {11366, 12633},
+    {11648, 13749}, {10737, 12978}, {10839, 14033}, {10106, 13318}, {10114, 14505},
+    {9440, 13607}, {9291, 14766}, {8731, 13789}, {8416, 14609}, {8000, 13744},
+    // zone 27
+    {7151, 14723}, {6893, 13801}, {6315, 14562}, {6246, 13398}, {5507, 14297},
+    {5596, 13109}, {4771, 13873}, {4868, 12936}, {4038, 13453}, {4252, 12531},
+    {3260, 13047}, {3689, 12048}, {2783, 12316}, {3416, 11330}, {2383, 11565},
+    {2924, 10791}, {1730, 10951}, {2732, 10086}, {1672, 10056}, {2503, 9411},
+    {1424, 9255}, {2326, 8717}, {1325, 8420}, {2301, 8000}, {1075, 7564},
+    {2419, 7295}, {1342, 6730}, {2451, 6575}, {1644, 5935}, {2549, 5842},
+    {1882, 5121}, {2953, 5226}, {2344, 4410}, {3415, 4669}, {2737, 3646},
+    {3857, 4109}, {3341, 3039}, {4310, 3539}, {4050, 2563}, {4946, 3188},
+    {4722, 2038}, {5577, 2852}, {5477, 1627}, {6203, 2470}, {6329, 1491},
+    {6915, 2314}, {7148, 1254}, {7645, 2354}, {8000, 1152}, {8357, 2332},
+    {8847, 1299}, {9094, 2264}, {9681, 1451}, {9754, 2603}, {10484, 1726},
+    {10496, 2696}, {11255, 2079}, {11084, 3140}, {11965, 2543}, {11729, 3492},
+    {12592, 3110}, {12129, 4123}, {13227, 3676}, {12585, 4669}, {13866, 4278},
+    {12983, 5261}, {14216, 5075}, {13356, 5879}, {14356, 5935}, {13628, 6555},
+    {14566, 6748}, {13757, 7273}, {14698, 7579}, {13798, 8000}, {14891, 8434},
+    {13606, 8708}, {14760, 9290}, {13718, 9468}, {14521, 10119}, {13458, 10161},
+    {14152, 10895}, {12990, 10743}, {13865, 11722}, {12707, 11420}, {13267, 12357},
+    {12231, 11973}, {12749, 13057}, {11664, 12429}, {12002, 13509}, {11048, 12803},
+    {11215, 13848}, {10399, 13099}, {10469, 14236}, {9798, 13532}, {9697, 14609},
+    {9060, 13558}, {8837, 14626}, {8363, 13773}, {8000, 14706}, {7644, 13662},
+    // zone 28
+    {6745, 14578}, {6565, 13591}, {5922, 14396}, {5913, 13270}, {5110, 14141},
+    {5185, 13121}, {4300, 13831}, {4531, 12775}, {3694, 13206}, {4091, 12163},
+    {3032, 12665}, {3510, 11714}, {2380, 12083}, {3183, 11057}, {2085, 11252},
+    {2904, 10398}, {1732, 10482}, {2564, 9766}, {1395, 9696}, {2299, 9088},
+    {1193, 8860}, {2129, 8369}, {1108, 8000}, {2302, 7642}, {1318, 7156},
+    {2401, 6932}, {1385, 6301}, {2589, 6242}, {1557, 5449}, {2759, 5534},
+    {2011, 4708}, {3179, 4940}, {2589, 4069}, {3662, 4411}, {3091, 3390},
+    {4049, 3792}, {3551, 2623}, {4623, 3351}, {4345, 2241}, {5287, 3066},
+    {5109, 1855}, {5858, 2590}, {5890, 1506}, {6548, 2343}, {6702, 1194},
+    {7288, 2367}, {7578, 1289}, {8000, 2310}, {8427, 1220}, {8723, 2275},
+    {9297, 1201}, {9452, 2345}, {10133, 1436}, {10159, 2546}, {10878, 1884},
+    {10834, 2846}, {11667, 2222}, {11405, 3313}, {12411, 2668}, {11920, 3826},
+    {12994, 3310}, {12519, 4262}, {13487, 4014}, {12769, 4974}, {13969, 4719},
+    {13338, 5488}, {14307, 5503}, {13377, 6253}, {14613, 6302}, {13550, 6941},
+    {14916, 7126}, {13637, 7645}, {14700, 8000}, {13670, 8357}, {14875, 8869},
+    {13534, 9056}, {14514, 9672}, {13431, 9764}, {14444, 10551}, {13148, 10422},
+    {14028, 11314}, {12841, 11072}, {13544, 12028}, {12524, 11743}, {12894, 12595},
+    {12003, 12263}, {12363, 13273}, {11324, 12575}, {11723, 13866}, {10736, 12977},
+    {10931, 14229}, {10154, 13441}, {10113, 14504}, {9427, 13558}, {9262, 14617},
+    {8728, 13760}, {8424, 14732}, {8000, 13759}, {7574, 14765}, {7281, 13693},
+    // zone 29
+    {6258, 14786}, {6044, 14020}, {5435, 14480}, {5403, 13519}, {4720, 13966},
+    {4646, 13285}, {3960, 13560}, {4047, 12778}, {3242, 13066}, {3462, 12261},
+    {2778, 12320}, {3052, 11595}, {2139, 11720}, {2463, 11044}, {1857, 10891},
+    {2335, 10243}, {1521, 10105}, {1883, 9570}, {1262, 9285}, {1878, 8773},
+    {1184, 8429}, {1658, 8000}, {1226, 7574}, {1735, 7209}, {1297, 6721},
+    {1973, 6452}, {1507, 5890}, {2339, 5758}, {1835, 5099}, {2632, 5049},
+    {2105, 4259}, {2869, 4272}, {2598, 3531}, {3532, 3804}, {3197, 2885},
+    {4102, 3288}, {3953, 2430}, {4728, 2844}, {4738, 2067}, {5321, 2307},
+    {5446, 1550}, {6032, 1943}, {6257, 1213}, {6858, 2011}, {7120, 1032},
+    {7602, 1674}, {8000, 1032}, {8396, 1708}, {8863, 1170}, {9186, 1785},
+    {9692, 1411}, {9902, 2145}, {10562, 1529}, {10646, 2376}, {11350, 1906},
+    {11308, 2788}, {12060, 2411}, {11891, 3297}, {12771, 2920}, {12478, 3795},
+    {13266, 3644}, {12988, 4376}, {13712, 4375}, {13474, 4990}, {14137, 5112},
+    {13883, 5671}, {14629, 5846}, {13981, 6464}, {14746, 6713}, {14291, 7205},
+    {14905, 7566}, {14326, 8000}, {14803, 8428}, {14318, 8798}, {14744, 9287},
+    {14148, 9578}, {14593, 10142}, {13918, 10343}, {14341, 10984}, {13537, 11044},
+    {13792, 11676}, {13035, 11658}, {13339, 12417}, {12505, 12231}, {12643, 12945},
+    {11976, 12806}, {12077, 13612}, {11324, 13237}, {11245, 13902}, {10702, 13743},
+    {10552, 14446}, {9901, 13851}, {9740, 14778}, {9189, 14235}, {8869, 14878},
+    {8383, 14089}, {8000, 15005}, {7618, 14076}, {7136, 14838}, {6847, 14046},
+    // zone 30
+    {5897, 14473}, {5747, 13691}, {5070, 14226}, {4997, 13463}, {4249, 13910},
+    {4342, 13035}, {3601, 13317}, {3709, 12570}, {3054, 12645}, {3095, 12058},
+    {2461, 12025}, {2796, 11303}, {1861, 11375}, {2464, 10605}, {1553, 10553},
+    {2055, 9932}, {1220, 9741}, {1963, 9152}, {1242, 8854}, {1869, 8386},
+    {1064, 8000}, {1671, 7602}, {1018, 7118}, {1772, 6812}, {1220, 6259},
+    {1970, 6041}, {1530, 5438}, {2329, 5331}, {2056, 4732}, {2685, 4627},
+    {2434, 3956}, {3255, 4075}, {3013, 3317}, {3680, 3399}, {3518, 2582},
+    {4319, 2934}, {4346, 2243}, {4934, 2422}, {5109, 1857}, {5734, 2277},
+    {5853, 1391}, {6443, 1936}, {6691, 1140}, {7225, 1863}, {7573, 1211},
+    {8000, 1697}, {8434, 1110}, {8773, 1885}, {9304, 1166}, {9550, 1965},
+    {10121, 1472}, {10336, 2099}, {10984, 1659}, {11036, 2477}, {11767, 2064},
+    {11655, 2970}, {12387, 2697}, {12254, 3469}, {12976, 3327}, {12870, 3971},
+    {13538, 3977}, {13275, 4653}, {14016, 4693}, {13541, 5393}, {14543, 5410},
+    {14017, 6045}, {14612, 6302}, {14012, 6853}, {14851, 7135}, {14134, 7614},
+    {14865, 8000}, {14277, 8395}, {14751, 8853}, {14015, 9147}, {14827, 9753},
+    {13792, 9882}, {14447, 10553}, {13559, 10616}, {13939, 11265}, {13154, 11271},
+    {13517, 12009}, {12687, 11877}, {13109, 12797}, {12265, 12541}, {12491, 13429},
+    {11571, 12915}, {11681, 13801}, {11030, 13511}, {10985, 14343}, {10262, 13714},
+    {10147, 14608}, {9541, 14001}, {9295, 14789}, {8762, 14030}, {8432, 14871},
+    {8000, 14184}, {7568, 14861}, {7210, 14253}, {6707, 14781}, {6446, 14054},
+    // zone 31
+    {5418, 14522}, {5318, 13700}, {4696, 14010}, {4602, 13355}, {3859, 13700},
+    {3998, 12837}, {3251, 13057}, {3554, 12175}, {2599, 12468}, {3074, 11579},
+    {2015, 11798}, {2612, 10962}, {1606, 11009}, {2284, 10263}, {1363, 10157},
+    {1922, 9561}, {1295, 9279}, {1720, 8793}, {1003, 8440}, {1807, 8000},
+    {964, 7557}, {1740, 7209}, {1211, 6705}, {1848, 6420}, {1309, 5826},
+    {2332, 5756}, {1782, 5074}, {2605, 5034}, {2102, 4257}, {2896, 4292},
+    {2638, 3564}, {3416, 3695}, {3221, 2911}, {4123, 3313}, {3925, 2391},
+    {4639, 2704}, {4601, 1817}, {5297, 2256}, {5437, 1527}, {6038, 1963},
+    {6243, 1156}, {6837, 1904}, {7140, 1196}, {7604, 1704}, {8000, 1138},
+    {8384, 1895}, {8862, 1180}, {9176, 1836}, {9715, 1319}, {9888, 2189},
+    {10609, 1410}, {10665, 2336}, {11382, 1848}, {11284, 2825}, {12030, 2453},
+    {11921, 3261}, {12683, 3013}, {12544, 3733}, {13272, 3639}, {13057, 4326},
+    {13818, 4308}, {13532, 4959}, {14196, 5084}, {13660, 5759}, {14544, 5874},
+    {14132, 6426}, {14886, 6686}, {14032, 7238}, {14980, 7561}, {14262, 8000},
+    {14948, 8437}, {14284, 8794}, {14953, 9326}, {13950, 9528}, {14715, 10182},
+    {13751, 10277}, {14289, 10959}, {13466, 11005}, {13757, 11653}, {12967, 11609},
+    {13434, 12496}, {12549, 12272}, {12684, 12988}, {11861, 12667}, {12059, 13586},
+    {11286, 13178}, {11282, 13970}, {10588, 13500}, {10577, 14508}, {9901, 13852},
+    {9746, 14799}, {9164, 14102}, {8863, 14832}, {8392, 14226}, {8000, 14809},
+    {7607, 14252}, {7112, 15029}, {6863, 13962}, {6267, 14749}, {6093, 13868},
+    // zone 32
+    {5031, 14310}, {4965, 13520}, {4304, 13823}, {4372, 12994}, {3565, 13361},
+    {3772, 12502}, {2921, 12769}, {3281, 11904}, {2233, 12190}, {2885, 11246},
+    {1946, 11328}, {2395, 10638}, {1617, 10527}, {2179, 9891}, {1251, 9733},
+    {2014, 9142}, {1155, 8865}, {1810, 8389}, {925, 8000}, {1683, 7603},
+    {993, 7115}, {2017, 6859}, {1344, 6291}, {2076, 6075}, {1518, 5433},
+    {2382, 5356}, {1912, 4653}, {2725, 4652}, {2471, 3983}, {3346, 4150},
+    {2994, 3299}, {3707, 3429}, {3629, 2717}, {4363, 2995}, {4202, 2015},
+    {5090, 2706}, {5046, 1722}, {5772, 2372}, {5796, 1216}, {6482, 2088},
+    {6672, 1038}, {7213, 1772}, {7570, 1162}, {8000, 1675}, {8442, 980},
+    {8780, 1822}, {9299, 1190}, {9521, 2075}, {10129, 1446}, {10269, 2268},
+    {11022, 1578}, {10992, 2557}, {11780, 2044}, {11621, 3016}, {12432, 2643},
+    {12158, 3572}, {13028, 3279}, {12776, 4049}, {13687, 3868}, {13136, 4741},
+    {14040, 4679}, {13705, 5315}, {14560, 5403}, {13751, 6131}, {14852, 6241},
+    {14001, 6855}, {15031, 7112}, {14219, 7609}, {14894, 8000}, {14090, 8383},
+    {14964, 8880}, {13938, 9133}, {14775, 9740}, {13749, 9868}, {14402, 10535},
+    {13638, 10653}, {14220, 11419}, {13117, 11247}, {13637, 12096}, {12825, 11992},
+    {13023, 12717}, {12317, 12597}, {12471, 13404}, {11584, 12933}, {11799, 13986},
+    {11013, 13481}, {10990, 14354}, {10288, 13779}, {10157, 14637}, {9550, 14038},
+    {9331, 14978}, {8762, 14030}, {8444, 15055}, {8000, 14254}, {7565, 14917},
+    {7222, 14156}, {6684, 14900}, {6467, 13971}, {5875, 14539}, {5676, 13871},
+    // zone 33
+    {4828, 13770}, {4850, 12964}, {4190, 13244}, {4298, 12475}, {3469, 12825},
+    {3687, 12050}, {2824, 12282}, {3405, 11339}, {2401, 11553}, {2959, 10771},
+    {2122, 10766}, {2697, 10099}, {1805, 10013}, {2325, 9457}, {1532, 9234},
+    {2217, 8731}, {1541, 8406}, {2262, 8000}, {1431, 7587}, {2144, 7260},
+    {1427, 6746}, {2435, 6571}, {1593, 5918}, {2601, 5862}, {1938, 5147},
+    {2868, 5179}, {2348, 4413}, {3398, 4656}, {2797, 3695}, {3815, 4070},
+    {3414, 3117}, {4232, 3445}, {4066, 2585}, {4886, 3094}, {4741, 2072},
+    {5514, 2718}, {5578, 1883}, {6226, 2540}, {6381, 1693}, {6913, 2302},
+    {7175, 1473}, {7635, 2205}, {8000, 1271}, {8368, 2156}, {8824, 1476},
+    {9079, 2344}, {9622, 1681}, {9778, 2528}, {10438, 1842}, {10472, 2747},
+    {11142, 2285}, {11151, 3035}, {11972, 2533}, {11767, 3446}, {12591, 3111},
+    {12230, 4028}, {13123, 3762}, {12736, 4559}, {13592, 4451}, {13067, 5215},
+    {13884, 5231}, {13412, 5857}, {14186, 5990}, {13718, 6532}, {14572, 6746},
+    {13711, 7279}, {14750, 7575}, {13622, 8000}, {14647, 8418}, {13683, 8718},
+    {14602, 9259}, {13557, 9427}, {14163, 10002}, {13444, 10155}, {13997, 10822},
+    {13057, 10780}, {13663, 11594}, {12564, 11316}, {12993, 12131}, {12257, 11998},
+    {12489, 12781}, {11682, 12450}, {11932, 13412}, {11070, 12838}, {11139, 13709},
+    {10431, 13166}, {10383, 14018}, {9752, 13392}, {9647, 14413}, {9091, 13717},
+    {8828, 14556}, {8358, 13696}, {8000, 14738}, {7630, 13882}, {7176, 14525},
+    {6934, 13589}, {6371, 14344}, {6203, 13530}, {5558, 14167}, {5571, 13162},
+    // zone 34
+    {4487, 13536}, {4570, 12721}, {3785, 13095}, {4101, 12152}, {3110, 12592},
+    {3602, 11638}, {2656, 11883}, {3150, 11078}, {2087, 11251}, {2753, 10469},
+    {1752, 10474}, {2611, 9751}, {1679, 9623}, {2453, 9058}, {1481, 8824},
+    {2188, 8366}, {1385, 8000}, {2333, 7643}, {1540, 7184}, {2481, 6947},
+    {1409, 6308}, {2627, 6254}, {1742, 5522}, {2682, 5498}, {2241, 4834},
+    {3145, 4919}, {2605, 4080}, {3466, 4249}, {3217, 3509}, {4066, 3811},
+    {3721, 2828}, {4678, 3428}, {4511, 2502}, {5174, 2859}, {5142, 1926},
+    {5828, 2514}, {5975, 1767}, {6595, 2527}, {6734, 1363}, {7266, 2193},
+    {7577, 1278}, {8000, 2181}, {8422, 1293}, {8712, 2368}, {9265, 1371},
+    {9416, 2487}, {10084, 1585}, {10067, 2778}, {10854, 1936}, {10721, 3050},
+    {11517, 2459}, {11340, 3403}, {12310, 2791}, {11948, 3795}, {12891, 3407},
+    {12346, 4405}, {13401, 4076}, {12752, 4984}, {13732, 4849}, {13122, 5590},
+    {14123, 5576}, {13602, 6180}, {14416, 6353}, {13663, 6920}, {14682, 7156},
+    {13675, 7643}, {14733, 8000}, {13672, 8357}, {14655, 8841}, {13692, 9086},
+    {14520, 9674}, {13439, 9767}, {14066, 10402}, {13243, 10467}, {13905, 11247},
+    {12796, 11043}, {13371, 11902}, {12477, 11704}, {12840, 12545}, {11944, 12200},
+    {12232, 13115}, {11296, 12537}, {11615, 13697}, {10794, 13083}, {10828, 14010},
+    {10088, 13275}, {10044, 14292}, {9402, 13460}, {9271, 14661}, {8730, 13778},
+    {8411, 14525}, {8000, 13609}, {7574, 14767}, {7272, 13759}, {6736, 14627},
+    {6535, 13705}, {5928, 14377}, {5838, 13460}, {5141, 14076}, {5248, 13006},
+    // zone 35
+    {4098, 13370}, {4412, 12337}, {3396, 12902}, {3806, 11938}, {2814, 12291},
+    {3415, 11331}, {2254, 11646}, {3007, 10745}, {2033, 10808}, {2719, 10091},
+    {1549, 10096}, {2435, 9429}, {1321, 9274}, {2449, 8701}, {1261, 8424},
+    {2119, 8000}, {1277, 7577}, {2400, 7292}, {1398, 6741}, {2334, 6545},
+    {1551, 5905}, {2626, 5872}, {1917, 5137}, {2930, 5213}, {2232, 4339},
+    {3321, 4601}, {2834, 3727}, {3730, 3990}, {3380, 3080}, {4376, 3619},
+    {3998, 2491}, {4970, 3226}, {4778, 2139}, {5501, 2690}, {5508, 1705},
+    {6207, 2483}, {6331, 1498}, {6907, 2268}, {7166, 1397}, {7644, 2345},
+    {8000, 1414}, {8358, 2309}, {8850, 1269}, {9086, 2308}, {9666, 1511},
+    {9760, 2583}, {10514, 1651}, {10403, 2894}, {11180, 2216}, {11153, 3031},
+    {11865, 2680}, {11628, 3615}, {12631, 3069}, {12076, 4173}, {13139, 3749},
+    {12535, 4705}, {13701, 4382}, {13030, 5235}, {13975, 5188}, {13476, 5832},
+    {14314, 5948}, {13467, 6596}, {14507, 6759}, {13837, 7263}, {14731, 7577},
+    {13704, 8000}, {14639, 8418}, {13707, 8721}, {14434, 9227}, {13512, 9415},
+    {14238, 10027}, {13378, 10129}, {14131, 10885}, {12956, 10725}, {13709, 11623},
+    {12591, 11336}, {13223, 12320}, {12231, 11973}, {12487, 12778}, {11712, 12487},
+    {11902, 13371}, {11120, 12916}, {11248, 13909}, {10415, 13131}, {10518, 14361},
+    {9794, 13523}, {9636, 14372}, {9059, 13552}, {8845, 14693}, {8362, 13758},
+    {8000, 14561}, {7633, 13835}, {7152, 14715}, {6930, 13611}, {6321, 14539},
+    {6210, 13509}, {5576, 14124}, {5585, 13131}, {4813, 13798}, {4974, 12769},
+    // zone 36
+    {3678, 13225}, {4107, 12146}, {3184, 12523}, {3594, 11645}, {2614, 11913},
+    {3145, 11081}, {2193, 11193}, {2803, 10446}, {1790, 10459}, {2474, 9795},
+    {1381, 9700}, {2231, 9100}, {1268, 8851}, {2147, 8368}, {1225, 8000},
+    {2176, 7634}, {1329, 7157}, {2426, 6937}, {1530, 6339}, {2653, 6263},
+    {1817, 5552}, {2761, 5535}, {2053, 4730}, {3078, 4877}, {2594, 4072},
+    {3678, 4425}, {3043, 3345}, {4141, 3891}, {3653, 2746}, {4641, 3376},
+    {4388, 2308}, {5275, 3043}, {5132, 1904}, {5876, 2635}, {5884, 1487},
+    {6584, 2485}, {6754, 1466}, {7290, 2381}, {7584, 1386}, {8000, 2409},
+    {8430, 1167}, {8715, 2338}, {9251, 1444}, {9455, 2334}, {10101, 1534},
+    {10059, 2799}, {10836, 1973}, {10779, 2945}, {11632, 2277}, {11289, 3474},
+    {12306, 2795}, {11953, 3790}, {12937, 3364}, {12506, 4272}, {13359, 4107},
+    {12832, 4933}, {13897, 4758}, {13252, 5529}, {14222, 5537}, {13410, 6242},
+    {14647, 6293}, {13556, 6940}, {14733, 7149}, {13819, 7634}, {14722, 8000},
+    {13780, 8364}, {14607, 8835}, {13752, 9097}, {14410, 9646}, {13430, 9764},
+    {14289, 10490}, {13070, 10386}, {13818, 11198}, {12764, 11023}, {13354, 11890},
+    {12496, 11719}, {12942, 12641}, {11985, 12244}, {12301, 13199}, {11436, 12730},
+    {11662, 13771}, {10804, 13100}, {10882, 14124}, {10056, 13193}, {10123, 14533},
+    {9396, 13438}, {9241, 14506}, {8716, 13664}, {8432, 14859}, {8000, 13767},
+    {7574, 14766}, {7282, 13685}, {6738, 14617}, {6547, 13659}, {5922, 14394},
+    {5897, 13313}, {5101, 14161}, {5268, 12970}, {4460, 13578}, {4723, 12510},
+    // zone 37
+    {3344, 12958}, {3903, 11847}, {2732, 12358}, {3387, 11352}, {2362, 11578},
+    {3082, 10704}, {2004, 10822}, {2591, 10142}, {1573, 10088}, {2544, 9401},
+    {1297, 9279}, {2267, 8724}, {1281, 8423}, {2246, 8000}, {1159, 7570},
+    {2303, 7280}, {1349, 6731}, {2585, 6610}, {1503, 5889}, {2605, 5864},
+    {1859, 5110}, {3116, 5315}, {2401, 4447}, {3461, 4702}, {2847, 3737},
+    {3736, 3995}, {3405, 3106}, {4372, 3615}, {3993, 2485}, {4992, 3260},
+    {4791, 2163}, {5520, 2729}, {5490, 1662}, {6251, 2617}, {6352, 1581},
+    {6951, 2502}, {7170, 1427}, {7647, 2397}, {8000, 1328}, {8352, 2407},
+    {8864, 1160}, {9076, 2361}, {9670, 1495}, {9783, 2511}, {10506, 1671},
+    {10448, 2797}, {11330, 1943}, {11106, 3105}, {11961, 2548}, {11570, 3684},
+    {12604, 3097}, {12089, 4160}, {13309, 3608}, {12566, 4683}, {13683, 4393},
+    {12944, 5282}, {14101, 5129}, {13278, 5910}, {14327, 5944}, {13599, 6562},
+    {14640, 6733}, {13631, 7289}, {14638, 7582}, {13737, 8000}, {14861, 8432},
+    {13673, 8717}, {14507, 9241}, {13657, 9453}, {14388, 10076}, {13439, 10154},
+    {14022, 10834}, {13050, 10776}, {13643, 11581}, {12558, 11312}, {13167, 12275},
+    {12237, 11979}, {12630, 12931}, {11612, 12366}, {12034, 13552}, {11010, 12743},
+    {11239, 13891}, {10405, 13110}, {10521, 14366}, {9800, 13540}, {9708, 14654},
+    {9051, 13508}, {8864, 14837}, {8361, 13740}, {8000, 14865}, {7648, 13592},
+    {7160, 14646}, {6914, 13693}, {6328, 14511}, {6265, 13338}, {5556, 14172},
+    {5590, 13122}, {4757, 13898}, {4932, 12834}, {4047, 13441}, {4343, 12420},
+    // zone 38
+    {2936, 12756}, {3169, 11997}, {2459, 12026}, {2784, 11310}, {2120, 11233},
+    {2318, 10674}, {1798, 10455}, {2117, 9912}, {1447, 9683}, {1996, 9145},
+    {1148, 8866}, {1778, 8391}, {1192, 8000}, {1801, 7610}, {1329, 7157},
+    {2026, 6860}, {1441, 6316}, {2065, 6072}, {1778, 5537}, {2501, 5413},
+    {1996, 4699}, {2780, 4687}, {2458, 3974}, {3156, 3993}, {3120, 3417},
+    {3662, 3381}, {3630, 2718}, {4290, 2894}, {4431, 2377}, {4977, 2501},
+    {5143, 1928}, {5767, 2360}, {5899, 1533}, {6451, 1969}, {6747, 1433},
+    {7211, 1753}, {7574, 1235}, {8000, 1682}, {8431, 1145}, {8784, 1790},
+    {9279, 1297}, {9516, 2096}, {10131, 1441}, {10297, 2198}, {10916, 1804},
+    {10960, 2616}, {11683, 2196}, {11618, 3021}, {12393, 2690}, {12292, 3429},
+    {13051, 3257}, {12719, 4096}, {13399, 4077}, {13273, 4654}, {14081, 4657},
+    {13738, 5300}, {14246, 5527}, {13997, 6051}, {14675, 6286}, {14101, 6836},
+    {14658, 7159}, {14172, 7612}, {14793, 8000}, {14083, 8383}, {14833, 8863},
+    {14017, 9148}, {14468, 9661}, {13829, 9894}, {14402, 10535}, {13491, 10584},
+    {14020, 11310}, {13312, 11371}, {13472, 11976}, {12760, 11938}, {12936, 12635},
+    {12207, 12480}, {12299, 13196}, {11721, 13121}, {11626, 13714}, {11013, 13481},
+    {10954, 14278}, {10256, 13699}, {10124, 14538}, {9508, 13873}, {9274, 14677},
+    {8783, 14199}, {8430, 14841}, {8000, 14138}, {7576, 14734}, {7238, 14033},
+    {6741, 14600}, {6433, 14105}, {5860, 14585}, {5736, 13717}, {5108, 14146},
+    {5023, 13416}, {4418, 13644}, {4390, 12968}, {3715, 13180}, {3776, 12498},
+    // zone 39
+    {2830, 12277}, {3041, 11603}, {2102, 11743}, {2541, 11001}, {1917, 10863},
+    {2353, 10236}, {1544, 10098}, {1876, 9572}, {1243, 9289}, {1921, 8768},
+    {1237, 8425}, {1816, 8000}, {1232, 7574}, {1949, 7236}, {1203, 6703},
+    {1873, 6427}, {1517, 5893}, {2304, 5745}, {1769, 5068}, {2484, 4967},
+    {2302, 4384}, {3000, 4367}, {2620, 3549}, {3559, 3830}, {3296, 2991},
+    {4149, 3345}, {3959, 2438}, {4641, 2708}, {4764, 2113}, {5433, 2544},
+    {5432, 1515}, {6097, 2144}, {6320, 1455}, {6863, 2038}, {7140, 1190},
+    {7610, 1802}, {8000, 1115}, {8395, 1715}, {8841, 1340}, {9173, 1852},
+    {9730, 1263}, {9875, 2228}, {10539, 1586}, {10674, 2317}, {11366, 1877},
+    {11383, 2669}, {11950, 2563}, {11988, 3180}, {12622, 3078}, {12548, 3729},
+    {13316, 3602}, {13069, 4317}, {13854, 4285}, {13534, 4958}, {14227, 5070},
+    {13669, 5756}, {14564, 5867}, {14112, 6431}, {14767, 6709}, {14242, 7211},
+    {14692, 7579}, {14301, 8000}, {14932, 8436}, {14245, 8789}, {14701, 9278},
+    {13947, 9527}, {14617, 10150}, {13726, 10267}, {14153, 10895}, {13311, 10920},
+    {13865, 11722}, {13101, 11706}, {13296, 12381}, {12571, 12292}, {12719, 13026},
+    {12032, 12874}, {12050, 13575}, {11379, 13325}, {11233, 13880}, {10583, 13490},
+    {10528, 14384}, {9877, 13776}, {9684, 14558}, {9133, 13940}, {8844, 14679},
+    {8386, 14141}, {8000, 14851}, {7620, 14039}, {7135, 14849}, {6871, 13920},
+    {6311, 14579}, {6123, 13778}, {5502, 14310}, {5418, 13488}, {4661, 14074},
+    {4759, 13107}, {3947, 13579}, {4156, 12647}, {3258, 13050}, {3547, 12181},
+    // zone 40
+    {2475, 12014}, {2860, 11262}, {1908, 11349}, {2503, 10587}, {1620, 10526},
+    {2136, 9905}, {1398, 9695}, {2070, 9131}, {1069, 8876}, {1995, 8378},
+    {1257, 8000}, {1777, 7609}, {1251, 7147}, {2064, 6868}, {1390, 6303},
+    {2031, 6061}, {1692, 5503}, {2422, 5375}, {2047, 4727}, {2891, 4758},
+    {2542, 4035}, {3186, 4017}, {2982, 3288}, {3802, 3529}, {3660, 2754},
+    {4364, 2995}, {4386, 2306}, {5059, 2650}, {5066, 1764}, {5682, 2146},
+    {5878, 1469}, {6492, 2128}, {6720, 1292}, {7211, 1756}, {7560, 1002},
+    {8000, 1951}, {8441, 988}, {8755, 2025}, {9312, 1120}, {9497, 2168},
+    {10089, 1570}, {10239, 2345}, {10910, 1816}, {11009, 2527}, {11607, 2317},
+    {11638, 2993}, {12374, 2713}, {12293, 3429}, {13121, 3191}, {12675, 4133},
+    {13559, 3961}, {13199, 4701}, {14071, 4662}, {13471, 5425}, {14464, 5441},
+    {13817, 6110}, {14795, 6255}, {14117, 6833}, {14757, 7146}, {14044, 7620},
+    {14992, 8000}, {13999, 8377}, {14752, 8853}, {13906, 9127}, {14560, 9684},
+    {13992, 9947}, {14258, 10478}, {13538, 10606}, {14143, 11377}, {13091, 11231},
+    {13582, 12056}, {12682, 11873}, {12939, 12638}, {12204, 12477}, {12449, 13377},
+    {11587, 12937}, {11703, 13835}, {10976, 13413}, {10959, 14288}, {10244, 13669},
+    {10165, 14664}, {9550, 14038}, {9298, 14806}, {8789, 14246}, {8426, 14771},
+    {8000, 14282}, {7561, 14973}, {7240, 14016}, {6713, 14745}, {6495, 13863},
+    {5888, 14501}, {5750, 13683}, {5051, 14266}, {5045, 13374}, {4368, 13723},
+    {4331, 13050}, {3532, 13401}, {3724, 12553}, {2929, 12762}, {3291, 11896},
+    // zone 41
+    {2264, 11640}, {2559, 10991}, {1853, 10893}, {2341, 10240}, {1299, 10177},
+    {2056, 9526}, {1231, 9291}, {1975, 8761}, {1177, 8429}, {2000, 8000},
+    {1174, 7571}, {1792, 7216}, {1278, 6718}, {1958, 6449}, {1456, 5874},
+    {2323, 5752}, {1677, 5025}, {2670, 5070}, {2067, 4235}, {2976, 4350},
+    {2579, 3515}, {3529, 3801}, {3246, 2937}, {4049, 3224}, {3856, 2296},
+    {4628, 2687}, {4693, 1985}, {5415, 2507}, {5413, 1466}, {6129, 2241},
+    {6263, 1236}, {6848, 1963}, {7132, 1126}, {7623, 2013}, {8000, 1088},
+    {8391, 1785}, {8856, 1221}, {9164, 1898}, {9753, 1174}, {9913, 2114},
+    {10585, 1470}, {10609, 2455}, {11361, 1886}, {11316, 2774}, {12111, 2342},
+    {11953, 3221}, {12759, 2932}, {12585, 3694}, {13416, 3520}, {12938, 4412},
+    {13734, 4361}, {13363, 5052}, {14186, 5089}, {13798, 5704}, {14680, 5829},
+    {13813, 6507}, {14826, 6698}, {14000, 7242}, {14863, 7568}, {14110, 8000},
+    {14803, 8428}, {14005, 8759}, {14701, 9278}, {13866, 9506}, {14525, 10120},
+    {13789, 10292}, {14182, 10909}, {13266, 10895}, {13928, 11762}, {12861, 11532},
+    {13395, 12463}, {12516, 12241}, {12743, 13051}, {11957, 12783}, {12002, 13508},
+    {11254, 13128}, {11316, 14032}, {10642, 13614}, {10538, 14411}, {9859, 13721},
+    {9690, 14582}, {9131, 13927}, {8866, 14857}, {8390, 14192}, {8000, 14859},
+    {7621, 14017}, {7124, 14932}, {6833, 14116}, {6284, 14682}, {6074, 13929},
+    {5501, 14311}, {5442, 13436}, {4734, 13941}, {4749, 13123}, {3936, 13594},
+    {4116, 12696}, {3325, 12978}, {3516, 12211}, {2572, 12491}, {3020, 11618},
+    // zone 42
+    {1911, 11348}, {2501, 10587}, {1507, 10571}, {2103, 9916}, {1172, 9753},
+    {1996, 9145}, {1078, 8874}, {1832, 8388}, {1099, 8000}, {1840, 7612},
+    {1068, 7124}, {1845, 6826}, {1311, 6283}, {2262, 6136}, {1625, 5476},
+    {2337, 5335}, {1828, 4607}, {2902, 4765}, {2480, 3990}, {3195, 4025},
+    {3038, 3340}, {3782, 3508}, {3530, 2596}, {4323, 2940}, {4337, 2228},
+    {5024, 2587}, {5054, 1740}, {5728, 2261}, {5823, 1299}, {6508, 2189},
+    {6685, 1105}, {7247, 2039}, {7560, 1011}, {8000, 1938}, {8435, 1088},
+    {8755, 2022}, {9330, 1030}, {9490, 2198}, {10104, 1523}, {10251, 2315},
+    {10992, 1643}, {10882, 2757}, {11677, 2206}, {11575, 3079}, {12495, 2566},
+    {12166, 3563}, {13095, 3216}, {12754, 4067}, {13729, 3838}, {13137, 4740},
+    {13983, 4711}, {13575, 5377}, {14468, 5439}, {13723, 6140}, {14781, 6259},
+    {14115, 6834}, {14988, 7117}, {13997, 7623}, {14855, 8000}, {14255, 8394},
+    {14838, 8864}, {14062, 9156}, {14790, 9743}, {13748, 9868}, {14358, 10517},
+    {13668, 10667}, {14089, 11347}, {13161, 11275}, {13563, 12042}, {12714, 11900},
+    {12988, 12684}, {12227, 12501}, {12341, 13247}, {11568, 12912}, {11690, 13814},
+    {10977, 13415}, {10924, 14214}, {10230, 13634}, {10169, 14675}, {9558, 14066},
+    {9317, 14906}, {8776, 14144}, {8444, 15063}, {8000, 14196}, {7559, 15004},
+    {7239, 14020}, {6715, 14738}, {6474, 13943}, {5858, 14593}, {5736, 13717},
+    {5072, 14222}, {5076, 13319}, {4332, 13779}, {4359, 13011}, {3646, 13263},
+    {3868, 12400}, {3020, 12677}, {3261, 11920}, {2378, 12085}, {2786, 11309},
+    // zone 43
+    {1682, 10973}, {2377, 10226}, {1341, 10164}, {1997, 9541}, {1111, 9314},
+    {1930, 8767}, {968, 8442}, {1823, 8000}, {992, 7559}, {2055, 7249},
+    {1167, 6697}, {2089, 6482}, {1428, 5865}, {2430, 5795}, {1785, 5075},
+    {2566, 5013}, {2004, 4195}, {3062, 4412}, {2692, 3609}, {3521, 3794},
+    {3249, 2940}, {4190, 3395}, {3944, 2417}, {4764, 2901}, {4621, 1854},
+    {5372, 2415}, {5428, 1505}, {6086, 2109}, {6295, 1361}, {6853, 1985},
+    {7118, 1017}, {7615, 1880}, {8000, 1123}, {8384, 1902}, {8884, 1003},
+    {9163, 1902}, {9763, 1133}, {9871, 2240}, {10553, 1551}, {10539, 2604},
+    {11398, 1819}, {11296, 2806}, {12082, 2382}, {11884, 3305}, {12849, 2837},
+    {12379, 3888}, {13286, 3627}, {12932, 4417}, {14023, 4178}, {13425, 5017},
+    {14313, 5029}, {13805, 5702}, {14709, 5820}, {13792, 6513}, {14889, 6686},
+    {14194, 7218}, {14963, 7562}, {14033, 8000}, {15055, 8444}, {14064, 8766},
+    {14849, 9307}, {13895, 9514}, {14592, 10142}, {13774, 10286}, {14439, 11030},
+    {13441, 10991}, {13964, 11785}, {12827, 11507}, {13366, 12439}, {12353, 12087},
+    {12816, 13128}, {11979, 12810}, {12022, 13536}, {11312, 13220}, {11340, 14075},
+    {10566, 13452}, {10607, 14585}, {9922, 13916}, {9714, 14675}, {9165, 14109},
+    {8882, 14983}, {8391, 14212}, {8000, 15065}, {7625, 13953}, {7113, 15018},
+    {6867, 13937}, {6241, 14851}, {6111, 13814}, {5437, 14473}, {5365, 13599},
+    {4664, 14068}, {4742, 13134}, {3930, 13602}, {4179, 12618}, {3121, 13195},
+    {3624, 12109}, {2529, 12526}, {3029, 11611}, {2037, 11785}, {2745, 10889},
+    // zone 44
+    {1705, 10492}, {2720, 9716}, {1667, 9626}, {2324, 9083}, {1441, 8829},
+    {2308, 8358}, {1332, 8000}, {2227, 7637}, {1305, 7154}, {2389, 6930},
+    {1540, 6341}, {2464, 6201}, {1704, 5507}, {2867, 5585}, {2181, 4801},
+    {3156, 4926}, {2691, 4143}, {3680, 4426}, {3180, 3474}, {4167, 3918},
+    {3841, 2972}, {4728, 3496}, {4410, 2343}, {5315, 3115}, {5124, 1888},
+    {5862, 2600}, {5916, 1586}, {6590, 2507}, {6744, 1415}, {7295, 2419},
+    {7575, 1251}, {8000, 2158}, {8417, 1378}, {8700, 2458}, {9265, 1367},
+    {9405, 2528}, {10068, 1635}, {10084, 2737}, {10865, 1911}, {10739, 3018},
+    {11491, 2498}, {11389, 3336}, {12150, 2983}, {11912, 3835}, {12817, 3477},
+    {12420, 4344}, {13361, 4105}, {12699, 5018}, {13852, 4783}, {13028, 5634},
+    {14066, 5598}, {13388, 6249}, {14437, 6347}, {13680, 6917}, {14664, 7158},
+    {13648, 7645}, {14602, 8000}, {13820, 8366}, {14558, 8828}, {13484, 9046},
+    {14459, 9659}, {13360, 9742}, {14232, 10468}, {13228, 10460}, {13790, 11183},
+    {12698, 10981}, {13353, 11889}, {12471, 11698}, {12899, 12601}, {11957, 12213},
+    {12271, 13162}, {11375, 12645}, {11588, 13654}, {10776, 13050}, {10882, 14124},
+    {10109, 13327}, {10062, 14345}, {9426, 13556}, {9237, 14482}, {8696, 13509},
+    {8421, 14684}, {8000, 13787}, {7590, 14518}, {7269, 13788}, {6754, 14529},
+    {6578, 13538}, {5988, 14193}, {5888, 13335}, {5156, 14043}, {5241, 13019},
+    {4472, 13560}, {4576, 12713}, {3772, 13111}, {4106, 12147}, {3233, 12476},
+    {3624, 11620}, {2696, 11854}, {3065, 11132}, {2215, 11181}, {2789, 10452},
+    // zone 45
+    {1571, 10089}, {2469, 9420}, {1505, 9239}, {2442, 8702}, {1464, 8411},
+    {2456, 8000}, {1407, 7585}, {2435, 7297}, {1451, 6751}, {2358, 6551},
+    {1643, 5935}, {2801, 5941}, {1844, 5103}, {3059, 5283}, {2405, 4450},
+    {3514, 4741}, {2888, 3771}, {3889, 4139}, {3507, 3216}, {4331, 3565},
+    {4001, 2496}, {5022, 3308}, {4749, 2086}, {5595, 2889}, {5509, 1707},
+    {6200, 2461}, {6342, 1543}, {6959, 2545}, {7161, 1358}, {7650, 2440},
+    {8000, 1213}, {8351, 2417}, {8839, 1358}, {9073, 2375}, {9674, 1479},
+    {9747, 2624}, {10425, 1876}, {10382, 2938}, {11159, 2254}, {11086, 3138},
+    {11889, 2647}, {11554, 3704}, {12647, 3051}, {12197, 4058}, {13147, 3742},
+    {12657, 4617}, {13752, 4350}, {13043, 5228}, {13915, 5217}, {13194, 5944},
+    {14403, 5919}, {13467, 6596}, {14667, 6728}, {13490, 7306}, {14526, 7589},
+    {13616, 8000}, {14701, 8422}, {13509, 8696}, {14693, 9277}, {13521, 9418},
+    {14452, 10096}, {13196, 10057}, {13933, 10792}, {13076, 10791}, {13621, 11567},
+    {12556, 11310}, {13110, 12227}, {12061, 11814}, {12613, 12913}, {11666, 12432},
+    {11927, 13405}, {11055, 12814}, {11176, 13777}, {10383, 13063}, {10402, 14068},
+    {9736, 13344}, {9635, 14369}, {9065, 13584}, {8849, 14720}, {8354, 13619},
+    {8000, 14725}, {7647, 13612}, {7161, 14638}, {6918, 13672}, {6367, 14359},
+    {6231, 13443}, {5597, 14069}, {5550, 13207}, {4792, 13834}, {4988, 12746},
+    {4168, 13274}, {4300, 12473}, {3516, 12775}, {3851, 11896}, {2965, 12165},
+    {3385, 11353}, {2324, 11602}, {2940, 10782}, {1855, 10891}, {2615, 10132},
+    // zone 46
+    {1615, 9639}, {2489, 9051}, {1247, 8853}, {2241, 8362}, {1403, 8000},
+    {2447, 7651}, {1295, 7153}, {2515, 6954}, {1365, 6296}, {2700, 6278},
+    {1712, 5510}, {2884, 5593}, {2258, 4843}, {3277, 5003}, {2457, 3972},
+    {3564, 4330}, {3020, 3324}, {4173, 3925}, {3822, 2950}, {4645, 3382},
+    {4346, 2242}, {5280, 3052}, {5140, 1923}, {5866, 2610}, {5965, 1736},
+    {6587, 2497}, {6734, 1363}, {7274, 2252}, {7574, 1227}, {8000, 2191},
+    {8419, 1344}, {8698, 2477}, {9233, 1536}, {9420, 2470}, {10109, 1509},
+    {10122, 2641}, {10812, 2025}, {10691, 3106}, {11550, 2405}, {11261, 3512},
+    {12211, 2910}, {11881, 3867}, {12917, 3383}, {12331, 4417}, {13540, 3975},
+    {12870, 4909}, {13840, 4790}, {13241, 5534}, {14247, 5527}, {13472, 6222},
+    {14362, 6367}, {13531, 6945}, {14586, 7168}, {13559, 7650}, {14618, 8000},
+    {13728, 8360}, {14718, 8849}, {13458, 9041}, {14463, 9660}, {13506, 9789},
+    {14104, 10417}, {13174, 10435}, {13841, 11211}, {12721, 10996}, {13347, 11885},
+    {12387, 11629}, {12961, 12659}, {11968, 12226}, {12227, 13109}, {11288, 12526},
+    {11527, 13557}, {10672, 12860}, {10797, 13944}, {10126, 13369}, {10075, 14386},
+    {9428, 13563}, {9251, 14560}, {8694, 13496}, {8426, 14771}, {8000, 13667},
+    {7577, 14726}, {7281, 13688}, {6744, 14584}, {6596, 13467}, {5946, 14323},
+    {5896, 13315}, {5189, 13973}, {5236, 13027}, {4352, 13748}, {4610, 12666},
+    {3817, 13057}, {4042, 12215}, {3209, 12499}, {3561, 11672}, {2512, 11988},
+    {3271, 11001}, {2173, 11203}, {2866, 10416}, {1812, 10450}, {2472, 9796},
+    // zone 47
+    {1341, 9270}, {2345, 8714}, {1393, 8416}, {2347, 8000}, {1243, 7575},
+    {2257, 7274}, {1430, 6747}, {2387, 6559}, {1725, 5961}, {2854, 5962},
+    {2019, 5186}, {3171, 5345}, {2255, 4354}, {3429, 4679}, {2909, 3789},
+    {3785, 4042}, {3470, 3176}, {4378, 3621}, {4044, 2555}, {5007, 3284},
+    {4696, 1990}, {5630, 2963}, {5505, 1698}, {6214, 2502}, {6308, 1412},
+    {6918, 2327}, {7158, 1333}, {7641, 2296}, {8000, 1330}, {8358, 2311},
+    {8863, 1170}, {9049, 2499}, {9696, 1393}, {9758, 2590}, {10474, 1751},
+    {10440, 2814}, {11270, 2053}, {11063, 3173}, {11902, 2630}, {11577, 3676},
+    {12539, 3166}, {12082, 4167}, {13147, 3742}, {12644, 4626}, {13636, 4423},
+    {12842, 5338}, {14056, 5150}, {13244, 5924}, {14549, 5872}, {13417, 6609},
+    {14690, 6724}, {13671, 7284}, {14815, 7571}, {13509, 8000}, {14814, 8429},
+    {13509, 8696}, {14649, 9268}, {13394, 9385}, {14284, 10042}, {13342, 10115},
+    {14051, 10848}, {13055, 10779}, {13583, 11543}, {12463, 11243}, {13296, 12381},
+    {12098, 11849}, {12704, 13009}, {11526, 12262}, {11948, 13434}, {11035, 12782},
+    {11262, 13933}, {10384, 13067}, {10429, 14134}, {9750, 13385}, {9699, 14618},
+    {9061, 13560}, {8850, 14731}, {8348, 13525}, {8000, 14703}, {7646, 13623},
+    {7162, 14631}, {6923, 13648}, {6334, 14490}, {6301, 13230}, {5554, 14177},
+    {5593, 13114}, {4772, 13872}, {4953, 12801}, {4042, 13447}, {4344, 12420},
+    {3459, 12836}, {3924, 11827}, {2887, 12230}, {3366, 11367}, {2390, 11560},
+    {3064, 10714}, {1850, 10894}, {2786, 10064}, {1712, 10043}, {2464, 9422},
+    // zone 48
+    {1188, 8861}, {1824, 8389}, {1086, 8000}, {1937, 7619}, {1357, 7161},
+    {2036, 6862}, {1506, 6333}, {2279, 6141}, {1799, 5545}, {2519, 5421},
+    {2130, 4773}, {2901, 4764}, {2637, 4104}, {3200, 4029}, {3152, 3447},
+    {3756, 3480}, {3768, 2884}, {4325, 2942}, {4404, 2334}, {5024, 2586},
+    {5110, 1858}, {5758, 2339}, {5918, 1594}, {6497, 2145}, {6743, 1412},
+    {7225, 1866}, {7567, 1113}, {8000, 1970}, {8429, 1187}, {8785, 1787},
+    {9279, 1296}, {9558, 1934}, {10050, 1692}, {10207, 2426}, {10853, 1938},
+    {10922, 2684}, {11671, 2216}, {11650, 2977}, {12410, 2669}, {12170, 3560},
+    {12895, 3403}, {12750, 4070}, {13463, 4031}, {13231, 4681}, {13879, 4768},
+    {13642, 5345}, {14187, 5550}, {13958, 6064}, {14536, 6322}, {14008, 6854},
+    {14625, 7163}, {14228, 7608}, {14848, 8000}, {14059, 8381}, {14827, 8862},
+    {13876, 9121}, {14625, 9701}, {13882, 9911}, {14383, 10527}, {13570, 10621},
+    {13926, 11258}, {13086, 11228}, {13515, 12007}, {12769, 11946}, {12952, 12650},
+    {12276, 12553}, {12269, 13161}, {11655, 13031}, {11552, 13597}, {10928, 13326},
+    {10853, 14062}, {10230, 13634}, {10093, 14442}, {9489, 13800}, {9296, 14796},
+    {8778, 14158}, {8421, 14691}, {8000, 14048}, {7582, 14640}, {7225, 14134},
+    {6742, 14596}, {6494, 13867}, {5866, 14567}, {5736, 13717}, {5054, 14261},
+    {5013, 13433}, {4361, 13735}, {4342, 13035}, {3767, 13117}, {3798, 12475},
+    {3117, 12586}, {3322, 11870}, {2412, 12060}, {2877, 11251}, {2079, 11255},
+    {2519, 10579}, {1693, 10497}, {2038, 9937}, {1551, 9656}, {1902, 9163},
+    // zone 49
+    {1083, 8435}, {1887, 8000}, {1092, 7565}, {2065, 7250}, {1312, 6724},
+    {2130, 6493}, {1421, 5862}, {2428, 5794}, {1912, 5135}, {2586, 5024},
+    {2183, 4309}, {3118, 4453}, {2644, 3569}, {3490, 3765}, {3338, 3035},
+    {4114, 3302}, {3947, 2421}, {4720, 2831}, {4704, 2005}, {5458, 2597},
+    {5486, 1651}, {6083, 2101}, {6337, 1523}, {6837, 1906}, {7162, 1366},
+    {7621, 1978}, {8000, 1292}, {8390, 1798}, {8858, 1212}, {9120, 2130},
+    {9725, 1281}, {9918, 2096}, {10531, 1607}, {10648, 2372}, {11344, 1918},
+    {11355, 2714}, {11955, 2557}, {11894, 3293}, {12712, 2982}, {12363, 3903},
+    {13292, 3622}, {12858, 4470}, {13685, 4392}, {13420, 5020}, {14204, 5080},
+    {13736, 5729}, {14544, 5874}, {13994, 6461}, {14669, 6728}, {14009, 7241},
+    {14868, 7568}, {14175, 8000}, {14948, 8437}, {14033, 8762}, {14751, 9288},
+    {13948, 9527}, {14473, 10103}, {13715, 10263}, {14168, 10903}, {13340, 10936},
+    {13743, 11645}, {13043, 11664}, {13239, 12334}, {12523, 12247}, {12573, 12870},
+    {11878, 12688}, {11920, 13395}, {11261, 13138}, {11256, 13923}, {10649, 13629},
+    {10533, 14399}, {9926, 13927}, {9679, 14541}, {9151, 14033}, {8842, 14666},
+    {8392, 14228}, {8000, 14858}, {7610, 14206}, {7151, 14723}, {6878, 13884},
+    {6320, 14544}, {6145, 13710}, {5469, 14393}, {5417, 13490}, {4689, 14023},
+    {4712, 13181}, {3986, 13525}, {4056, 12767}, {3303, 13001}, {3549, 12180},
+    {2810, 12294}, {3167, 11511}, {2289, 11624}, {2694, 10917}, {1713, 10958},
+    {2424, 10208}, {1383, 10150}, {2156, 9501}, {1292, 9280}, {1946, 8765},
+};
+
+#define BENCH_POLY(i, minLat, minLon, maxLat, maxLon) \
+    {1070000L + (i) * 20, 10660000L + (i) * 20, minLat, minLon, maxLat, maxLon, (i) * 100, 100, GEO_ALLOWED}
+
+static const GeoPolygon BENCH_POLYGONS[] PROGMEM = {
+    BENCH_POLY(0, 1338, 1267, 14662, 14705),
+    BENCH_POLY(1, 1252, 1294, 14705, 14618),
+    BENCH_POLY(2, 1245, 1219, 14785, 14764),
+    BENCH_POLY(3, 1309, 1278, 14671, 14630),
+    BENCH_POLY(4, 1143, 1172, 14891, 14840),
+    BENCH_POLY(5, 1179, 1216, 14808, 14902),
+    BENCH_POLY(6, 1187, 1145, 14895, 14870),
+    BENCH_POLY(7, 1118, 1202, 14993, 14868),
+    BENCH_POLY(8, 1042, 1024, 15041, 15016),
+    BENCH_POLY(9, 1048, 1030, 15006, 15068),
+    BENCH_POLY(10, 880, 998, 15027, 15101),
+    BENCH_POLY(11, 1262, 1426, 14600, 14652),
+    BENCH_POLY(12, 1301, 1320, 14785, 14697),
+    BENCH_POLY(13, 1387, 1289, 14701, 14727),
+    BENCH_POLY(14, 1386, 1289, 14677, 14773),
+    BENCH_POLY(15, 1188, 1137, 14710, 14828),
+    BENCH_POLY(16, 1195, 1230, 14856, 14802),
+    BENCH_POLY(17, 1054, 1125, 14814, 14853),
+    BENCH_POLY(18, 1013, 1160, 14890, 14977),
+    BENCH_POLY(19, 1027, 1149, 15035, 14993),
+    BENCH_POLY(20, 1141, 1072, 14874, 14946),
+    BENCH_POLY(21, 965, 940, 14900, 15035),
+    BENCH_POLY(22, 1326, 1303, 14650, 14717),
+    BENCH_POLY(23, 1273, 1286, 14696, 14735),
+    BENCH_POLY(24, 1332, 1231, 14768, 14779),
+    BENCH_POLY(25, 1165, 1152, 14802, 14745),
+    BENCH_POLY(26, 1201, 1226, 14849, 14766),
+    BENCH_POLY(27, 1075, 1152, 14891, 14723),
+    BENCH_POLY(28, 1108, 1194, 14916, 14765),
+    BENCH_POLY(29, 1184, 1032, 14905, 15005),
+    BENCH_POLY(30, 1018, 1110, 14865, 14871),
+    BENCH_POLY(31, 964, 1138, 14980, 15029),
+    BENCH_POLY(32, 925, 980, 15031, 15055),
+    BENCH_POLY(33, 1427, 1271, 14750, 14738),
+    BENCH_POLY(34, 1385, 1278, 14733, 14767),
+    BENCH_POLY(35, 1261, 1269, 14731, 14715),
+    BENCH_POLY(36, 1225, 1167, 14733, 14859),
+    BENCH_POLY(37, 1159, 1160, 14861, 14865),
+    BENCH_POLY(38, 1148, 1145, 14833, 14841),
+    BENCH_POLY(39, 1203, 1115, 14932, 14851),
+    BENCH_POLY(40, 1069, 988, 14992, 14973),
+    BENCH_POLY(41, 1174, 1088, 14863, 14932),
+    BENCH_POLY(42, 1068, 1011, 14988, 15063),
+    BENCH_POLY(43, 968, 1003, 15055, 15065),
+    BENCH_POLY(44, 1305, 1251, 14664, 14684),
+    BENCH_POLY(45, 1407, 1213, 14701, 14725),
+    BENCH_POLY(46, 1247, 1227, 14718, 14771),
+    BENCH_POLY(47, 1243, 1170, 14815, 14731),
+    BENCH_POLY(48, 1086, 1113, 14848, 14796),
+    BENCH_POLY(49, 1083, 1212, 14948, 14858),
+};
+
+static const uint8_t BENCH_POLYGON_COUNT = sizeof(BENCH_POLYGONS) / sizeof(BENCH_POLYGONS[0]);
+
+ProgmemZoneSource benchZones(BENCH_POLYGONS, BENCH_POLYGON_COUNT, BENCH_VERTICES);
+GeofenceEngine geofence(benchZones);
+
+// tâm chung của các polygon (trong tất cả)
+static const int32_t TEST_LAT_E7 = 107850000L;
+static const int32_t TEST_LON_E7 = 1066850000L;
+static const uint16_t RUNS = 100;
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial) {}
+
+    Serial.println(F("=== Geofence: 50 polygons x 100 vertices ==="));
+    geofence.begin();
+
+    // 1) check đầy đủ (không skip / hysteresis)
+    uint32_t total = 0, maxUs = 0;
+    bool outside = false;
+    for (uint16_t i = 0; i < RUNS; ++i)
+    {
+        uint32_t edge;
+        // lệch nhẹ mỗi lần để không đo mãi một nhánh
+        int32_t lat = TEST_LAT_E7 + (int32_t)(i % 10) * 1000;
+        int32_t lon = TEST_LON_E7 - (int32_t)(i / 10) * 1000;
+
+        uint32_t t0 = micros();
+        outside = geofence.classify(lat, lon, edge);
+        uint32_t dt = micros() - t0;
+
+        total += dt;
+        if (dt > maxUs)
+            maxUs = dt;
+    }
+
+    uint32_t avgUs = total / RUNS;
+    Serial.print(F("full check outside="));
+    Serial.print(outside);
+    Serial.print(F(" avgUs="));
+    Serial.print(avgUs);
+    Serial.print(F(" maxUs="));
+    Serial.print(maxUs);
+    Serial.print(F(" cycles="));
+    Serial.println(avgUs * (F_CPU / 1000000UL));
+
+    // 2) đường đi thực tế 1 fix/giây: phần lớn check được bỏ qua
+    int32_t lat = TEST_LAT_E7, lon = TEST_LON_E7;
+    total = 0;
+    for (uint16_t i = 0; i < 600; ++i)
+    {
+        lon += 500; // ~5.5 m/s
+        uint32_t t0 = micros();
+        geofence.update(lat, lon);
+        total += micros() - t0;
+    }
+
+    Serial.print(F("track 600 fixes avgUs="));
+    Serial.println(total / 600);
+    geofence.printStats();
+}
+
+void loop()
+{
+}
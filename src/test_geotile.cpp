@@ -0,0 +1,164 @@
+#include <Arduino.h>
+#include <util/crc16.h>
+#include "GeofenceConfiguration/GeofenceTileStore.h"
+#include "GeofenceConfiguration/GeofenceEngine.h"
+
+// =====================================================
+// GeofenceTileStore: cập nhật tile xe đang đứng, không báo động giả
+//
+// Xe đứng yên giữa polygon của tile v1 (6 slot đã đầy → phải bỏ 1 tile
+// khác để lấy chỗ). Server gửi v2 của chính tile đó; mỗi loop() giả lập
+// gọi service() rồi chọn nguồn như selectGeofenceZones() trong main.cpp.
+// Trong suốt lúc ghi nền: covers() luôn true (không rơi về zone build
+// sẵn), GeofenceEngine không báo OUT_OF_BOUND / BOUNDARY_CROSS.
+// Sau đó dựng lại từ EEPROM: chỉ còn v2.
+//
+// Ghi đè vùng tile EEPROM. Build riêng (đổi src_filter sang
+// +<test_geotile.cpp>), Serial 115200.
+// =====================================================
+
+static const int32_t LAT5 = 1085766;   // 10.85766, 106.76659
+static const int32_t LON5 = 10676659;
+
+// không có zone build sẵn: rơi về nguồn này = ngoài vùng
+ProgmemZoneSource noZones(nullptr, 0, nullptr);
+GeofenceTileStore geoTiles;
+GeofenceEngine geofence(noZones);
+const GeoZoneSource *activeZones = &noZones;
+
+static uint8_t msg[12 + sizeof(GeoTilePolygonRecord) + 4 * sizeof(GeoVertex)];
+
+// FULL: 1 polygon vuông cạnh `size` đơn vị 1e-5°, góc dưới trái (lat5, lon5)
+static uint16_t buildFullTile(const char *gh, uint16_t version,
+                              int32_t lat5, int32_t lon5, int16_t size)
+{
+    uint8_t *d = &msg[12];
+    GeoTilePolygonRecord r = {GEO_ALLOWED, 4, 0, lat5, lon5};
+    memcpy(d, &r, sizeof(r));
+    GeoVertex v[4] = {{0, 0}, {0, size}, {size, size}, {size, 0}};
+    memcpy(d + sizeof(r), v, sizeof(v));
+    uint16_t n = sizeof(r) + sizeof(v);
+
+    uint16_t crc = 0xFFFF;
+    for (uint16_t i = 0; i < n; ++i)
+        crc = _crc_ccitt_update(crc, d[i]);
+
+    msg[0] = GEO_TILE_FULL;
+    memcpy(&msg[1], gh, GEOHASH_TILE_LEN);
+    msg[6] = version & 0xFF;
+    msg[7] = version >> 8;
+    msg[8] = crc & 0xFF;
+    msg[9] = crc >> 8;
+    msg[10] = n & 0xFF;
+    msg[11] = n >> 8;
+    return 12 + n;
+}
+
+static void commit(uint16_t len)
+{
+    geoTiles.apply(msg, len);
+    while (geoTiles.busy())
+        geoTiles.service();
+}
+
+// selectGeofenceZones() + check của main.cpp; true = có báo động
+static bool step(bool tableChanged, bool &covered)
+{
+    covered = geoTiles.covers(LAT5, LON5);
+    const GeoZoneSource *zones = covered ? (const GeoZoneSource *)&geoTiles
+                                         : (const GeoZoneSource *)&noZones;
+    if (zones != activeZones || tableChanged)
+    {
+        activeZones = zones;
+        geofence.setSource(*zones);
+    }
+    return geofence.update(LAT5 * 100L, LON5 * 100L) && geofence.isOutside();
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial) {}
+
+    Serial.println(F("=== Geofence tile update in place ==="));
+
+    char gh[GEOHASH_TILE_LEN];
+    geohashEncode(LAT5, LON5, gh);
+
+    geoTiles.begin();
+    commit(buildFullTile(gh, 1, LAT5 - 50, LON5 - 50, 100));
+    for (uint8_t k = 1; k < GeofenceTileStore::SLOT_COUNT; ++k)
+    {
+        char other[GEOHASH_TILE_LEN];
+        geohashEncode(LAT5 + 5000L * k, LON5, other);
+        commit(buildFullTile(other, 1, LAT5 + 5000L * k, LON5, 100));
+    }
+
+    bool covered;
+    for (uint8_t i = 0; i < 10; ++i)
+        step(geoTiles.service(), covered);
+
+    uint8_t pass = 0, total = 0;
+
+    total++;
+    bool ok = covered && !geofence.isOutside();
+    pass += ok;
+    Serial.print(F("inside v1"));
+    Serial.println(ok ? F(" PASS") : F(" FAIL"));
+
+    // v2 cùng tile, polygon to hơn một chút
+    geoTiles.apply(msg, buildFullTile(gh, 2, LAT5 - 60, LON5 - 60, 120));
+    uint16_t steps = 0, uncovered = 0, alerts = 0;
+    while (true)
+    {
+        bool changed = geoTiles.service();
+        if (step(changed, covered))
+            alerts++;
+        if (!covered)
+            uncovered++;
+        steps++;
+        if (!geoTiles.busy())
+            break;
+    }
+
+    total++;
+    ok = uncovered == 0 && alerts == 0;
+    pass += ok;
+    Serial.print(F("update v2: steps="));
+    Serial.print(steps);
+    Serial.print(F(" uncovered="));
+    Serial.print(uncovered);
+    Serial.print(F(" alerts="));
+    Serial.print(alerts);
+    Serial.println(ok ? F(" PASS") : F(" FAIL"));
+
+    total++;
+    ok = geoTiles.versionOf(gh) == 2 && geoTiles.evictions == 1;
+    pass += ok;
+    Serial.print(F("version="));
+    Serial.print(geoTiles.versionOf(gh));
+    Serial.print(F(" evictions="));
+    Serial.print(geoTiles.evictions);
+    Serial.println(ok ? F(" PASS") : F(" FAIL"));
+
+    total++;
+    GeofenceTileStore reloaded;
+    reloaded.begin();
+    ok = reloaded.versionOf(gh) == 2 &&
+         reloaded.polygonCount() == GeofenceTileStore::SLOT_COUNT - 1;
+    pass += ok;
+    Serial.print(F("reload: version="));
+    Serial.print(reloaded.versionOf(gh));
+    Serial.print(F(" polygons="));
+    Serial.print(reloaded.polygonCount());
+    Serial.println(ok ? F(" PASS") : F(" FAIL"));
+
+    Serial.print(F("passed "));
+    Serial.print(pass);
+    Serial.print(F("/"));
+    Serial.println(total);
+}
+
+void loop()
+{
+}
@@ -46,14 +46,21 @@ void setup()
 // -------------------------------
 void loop()
 {
-    if (imu.update())
+    // FIFO phải được rút liên tục (85 mẫu ≈ 0.85 s @100 Hz trước khi tràn)
+    imu.update();
+
+    static unsigned long lastPrint = 0;
+    if (millis() - lastPrint < 1000UL) return; // 1 Hz print for easy reading
+    lastPrint = millis();
+
+    if (imu.initialized)
     {
         imu.printDebug();
+        imu.printStats();
     }
     else
     {
         Serial.println("IMU not initialized");
     }
     Serial.println(currentState == VehicleState::UPRIGHT ? "Vehicle is UPRIGHT" : "Vehicle is NOT UPRIGHT");
-    delay(1000); // 1 Hz update for easy reading
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include <Arduino.h>
+#include "MotionConfiguration/MotionEngine.h"
+
+// =====================================================
+// Odometer benchmark: equirectangular fixed-point vs Haversine float
+//
+// Track: vòng chạy ~3.4 km quanh điểm test (Thủ Đức), 1 fix/giây,
+// tốc độ 15–25 km/h, có đoạn rẽ. Lưu dạng delta (E7) trong flash
+// giống dữ liệu UBX NAV-PVT ghi lại.
+//
+// Build riêng (đổi src_filter sang +<test_odometer.cpp>), mở
+// Serial 115200: in tổng quãng đường của 2 cách + µs / lần tính.
+// =====================================================
+
+static const int32_t START_LAT_E7 = 108514327L;
+static const int32_t START_LON_E7 = 1067546240L;
+
+// mỗi đoạn: số fix, dLat/fix, dLon/fix (E7)
+struct Leg
+{
+    uint16_t fixes;
+    int16_t dLat;
+    int16_t dLon;
+};
+
+static const Leg TRACK[] PROGMEM = {
+    {60, 500, 0},     // bắc ~5.6 m/s
+    {20, 350, 350},   // rẽ đông bắc
+    {90, 0, 600},     // đông ~6.6 m/s
+    {30, -400, 250},
+    {80, -550, 0},    // nam
+    {25, -300, -300},
+    {100, 0, -560},   // tây
+    {40, 420, -120},
+    {15, 0, 0},       // dừng đèn đỏ
+    {50, 180, -60},
+};
+
+// Haversine gốc (GpsConfiguration::distanceBetween)
+static float haversineM(float lat1, float lng1, float lat2, float lng2)
+{
+    const float R = 6371000.0f;
+    float dLat = radians(lat2 - lat1);
+    float dLng = radians(lng2 - lng1);
+    float a = sin(dLat / 2) * sin(dLat / 2) +
+              cos(radians(lat1)) * cos(radians(lat2)) *
+                  sin(dLng / 2) * sin(dLng / 2);
+    float c = 2 * atan2(sqrt(a), sqrt(1 - a));
+    return R * c;
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial) {}
+
+    Serial.println(F("=== Odometer: equirectangular (int) vs Haversine (float) ==="));
+
+    uint16_t cosQ15 = (uint16_t)(cos(radians(START_LAT_E7 * 1e-7f)) * 32768.0f);
+
+    int32_t lat = START_LAT_E7, lon = START_LON_E7;
+    uint32_t equiMm = 0;
+    float haverM = 0;
+    uint32_t equiUs = 0, haverUs = 0, steps = 0;
+
+    for (uint8_t l = 0; l < sizeof(TRACK) / sizeof(TRACK[0]); ++l)
+    {
+        Leg leg;
+        memcpy_P(&leg, &TRACK[l], sizeof(leg));
+
+        for (uint16_t i = 0; i < leg.fixes; ++i)
+        {
+            int32_t nLat = lat + leg.dLat;
+            int32_t nLon = lon + leg.dLon;
+
+            uint32_t t0 = micros();
+            uint32_t mm = equirectDistanceMm(lat, lon, nLat, nLon, cosQ15);
+            uint32_t t1 = micros();
+            float m = haversineM(lat * 1e-7f, lon * 1e-7f, nLat * 1e-7f, nLon * 1e-7f);
+            uint32_t t2 = micros();
+
+            equiUs += t1 - t0;
+            haverUs += t2 - t1;
+            equiMm += mm;
+            haverM += m;
+            steps++;
+
+            lat = nLat;
+            lon = nLon;
+        }
+    }
+
+    Serial.print(F("steps="));
+    Serial.println(steps);
+    Serial.print(F("equirect m="));
+    Serial.print(equiMm / 1000.0f, 2);
+    Serial.print(F(" us/step="));
+    Serial.println((float)equiUs / steps, 1);
+    Serial.print(F("haversine m="));
+    Serial.print(haverM, 2);
+    Serial.print(F(" us/step="));
+    Serial.println((float)haverUs / steps, 1);
+    Serial.print(F("diff %="));
+    Serial.println((equiMm / 1000.0f - haverM) / haverM * 100.0f, 4);
+}
+
+void loop()
+{
+}
@@ -0,0 +1,129 @@
+#include <Arduino.h>
+#include "PowerConfiguration/ParkGuard.h"
+
+// =====================================================
+// ParkGuard chống trộm: phát lại kịch bản chuyển động sau chuyến
+//
+// Thời gian giả lập (bước 100 ms), không cần MPU6050 thật: imu không
+// begin() nên enter/exitMotionWake không chạm I2C, chuyển động đưa vào
+// qua imu.lastMotionMs. Mỗi kịch bản: 10 s chạy chuyến rồi đỗ 120 s.
+// Build riêng (đổi src_filter sang +<test_park.cpp>), Serial 115200.
+// =====================================================
+
+int16_t accelX = 0, accelY = 0, accelZ = 0;
+int16_t gyroRollRate = 0, gyroPitchRate = 0, gyroYawRate = 0;
+VehicleState currentState = VehicleState::UPRIGHT;
+unsigned long znStableSinceMs = 0;
+float znRounded1dp = 0.0f;
+
+ImuConfiguration imu(
+    accelX, accelY, accelZ,
+    gyroRollRate, gyroPitchRate, gyroYawRate,
+    currentState,
+    znStableSinceMs,
+    znRounded1dp);
+
+enum Scenario : uint8_t
+{
+    WALK_TO_RACK = 0,  // dắt xe 20 s ngay sau chuyến rồi dựng → không báo
+    MOVED_AT_END,      // xe còn lắc liên tục 12 s sau chuyến → không báo
+    QUIET_THEN_MOVED,  // yên 40 s rồi bị dắt đi 10 s → báo 1 lần
+    BUMPED_BEFORE_ARM, // yên 20 s, chạm 5 s, yên 20 s rồi dắt → chưa arm
+    SCENARIO_COUNT
+};
+
+static const char *const SCENARIO_NAMES[] = {
+    "walk to rack", "moved at end", "quiet then moved", "bumped before arm"};
+
+static const uint8_t SCENARIO_EXPECT[] = {0, 0, 1, 0};
+
+static const uint32_t TRIP_MS = 10000UL;
+static const uint32_t PARKED_MS = 120000UL;
+static const uint16_t STEP_MS = 100;
+
+// t = ms kể từ lúc đỗ
+static bool moving(Scenario sc, uint32_t t)
+{
+    switch (sc)
+    {
+    case WALK_TO_RACK:
+        return t < 20000UL;
+    case MOVED_AT_END:
+        return t < 12000UL;
+    case QUIET_THEN_MOVED:
+        return t >= 40000UL && t < 50000UL;
+    case BUMPED_BEFORE_ARM:
+        return (t >= 20000UL && t < 25000UL) || (t >= 45000UL && t < 55000UL);
+    default:
+        return false;
+    }
+}
+
+static uint8_t runScenario(Scenario sc, uint32_t &armedAfterMs)
+{
+    ParkGuard guard(imu);
+    imu.lastMotionMs = 0;
+    armedAfterMs = 0;
+
+    uint8_t alerts = 0;
+    unsigned long now = 1000;
+
+    // chuyến: xe chạy, chuyển động liên tục
+    for (uint32_t t = 0; t < TRIP_MS; t += STEP_MS, now += STEP_MS)
+    {
+        imu.lastMotionMs = now;
+        guard.update(now, false, 0);
+    }
+
+    for (uint32_t t = 0; t < PARKED_MS; t += STEP_MS, now += STEP_MS)
+    {
+        if (moving(sc, t))
+            imu.lastMotionMs = now;
+        guard.update(now, true, 0);
+
+        if (guard.theftIsArmed() && armedAfterMs == 0)
+            armedAfterMs = t;
+        if (guard.hasTheftEvent())
+        {
+            alerts++;
+            guard.clearTheftEvent();
+        }
+    }
+    return alerts;
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial) {}
+
+    Serial.println(F("=== ParkGuard theft arming ==="));
+
+    uint8_t pass = 0;
+    for (uint8_t i = 0; i < SCENARIO_COUNT; ++i)
+    {
+        uint32_t armedAfterMs;
+        uint8_t alerts = runScenario((Scenario)i, armedAfterMs);
+        bool ok = alerts == SCENARIO_EXPECT[i];
+        if (ok)
+            pass++;
+
+        Serial.print(SCENARIO_NAMES[i]);
+        Serial.print(F(": alerts="));
+        Serial.print(alerts);
+        Serial.print(F(" expect="));
+        Serial.print(SCENARIO_EXPECT[i]);
+        Serial.print(F(" armed after(ms)="));
+        Serial.print(armedAfterMs);
+        Serial.println(ok ? F(" PASS") : F(" FAIL"));
+    }
+
+    Serial.print(F("passed "));
+    Serial.print(pass);
+    Serial.print(F("/"));
+    Serial.println(SCENARIO_COUNT);
+}
+
+void loop()
+{
+}
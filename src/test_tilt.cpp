@@ -0,0 +1,98 @@
+#include <Arduino.h>
+#include <Wire.h>
+#include "ImuConfiguration/ImuConfiguraton.h"
+
+// =====================================================
+// Tilt classifier: số chu kỳ CPU / mẫu, float cũ vs số nguyên
+//
+// Float (bản cũ): sqrtf |A|, chia z/|A|, roundf 1 chữ số, so ngưỡng.
+// Số nguyên: complementary filter gyro + accel (fuseSample) rồi
+// tiltDecile (so bình phương, không sqrt / chia) + logic hold.
+// Không cần MPU6050 thật: mẫu tổng hợp xe nghiêng dần 0 → 180°.
+// Build riêng (đổi src_filter sang +<test_tilt.cpp>), Serial 115200.
+// =====================================================
+
+int16_t accelX = 0, accelY = 0, accelZ = 0;
+int16_t gyroRollRate = 0, gyroPitchRate = 0, gyroYawRate = 0;
+VehicleState currentState = VehicleState::UPRIGHT;
+unsigned long znStableSinceMs = 0;
+float znRounded1dp = 0.0f;
+
+ImuConfiguration imu(
+    accelX, accelY, accelZ,
+    gyroRollRate, gyroPitchRate, gyroYawRate,
+    currentState,
+    znStableSinceMs,
+    znRounded1dp);
+
+static const uint16_t SAMPLES = 512;
+static ImuSample samples[SAMPLES];
+
+// phân loại float như updateStateFromAccel() trước đây (không gồm hold)
+static VehicleState classifyFloat(const ImuSample &s)
+{
+    float A = sqrtf((float)s.ax * s.ax + (float)s.ay * s.ay + (float)s.az * s.az);
+    if (A <= 0.0001f) return VehicleState::UNKNOWN;
+    float z1 = ImuConfiguration::round1dp(s.az / A);
+    if (z1 >= 0.8f) return VehicleState::UPRIGHT;
+    if (z1 >= 0.7f) return VehicleState::TILTED;
+    if (z1 >= 0.0f) return VehicleState::ON_SIDE;
+    return VehicleState::UPSIDE_DOWN;
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial) {}
+
+    Serial.println(F("=== Tilt classifier: float vs integer ==="));
+
+    // nghiêng quanh trục X, 180° trong SAMPLES mẫu + rung ±0.1 g
+    randomSeed(1);
+    for (uint16_t k = 0; k < SAMPLES; ++k)
+    {
+        float t = PI * k / SAMPLES;
+        samples[k].ax = (int16_t)random(-200, 201);
+        samples[k].ay = (int16_t)(sinf(t) * IMU_ACCEL_LSB_PER_G) + (int16_t)random(-200, 201);
+        samples[k].az = (int16_t)(cosf(t) * IMU_ACCEL_LSB_PER_G) + (int16_t)random(-200, 201);
+        samples[k].gx = (int16_t)(180.0f / SAMPLES * IMU_SAMPLE_RATE_HZ * IMU_GYRO_LSB_PER_DPS_X10 / 10);
+        samples[k].gy = samples[k].gz = 0;
+    }
+
+    // 1) float
+    volatile uint8_t sink = 0;
+    uint32_t t0 = micros();
+    for (uint16_t k = 0; k < SAMPLES; ++k)
+        sink += (uint8_t)classifyFloat(samples[k]);
+    uint32_t floatUs = micros() - t0;
+
+    // 2) số nguyên (fuse + decile + hold)
+    t0 = micros();
+    unsigned long now = millis();
+    for (uint16_t k = 0; k < SAMPLES; ++k)
+    {
+        imu.fuseSample(samples[k]);
+        imu.updateTilt(now);
+    }
+    uint32_t intUs = micros() - t0;
+    sink += (uint8_t)currentState;
+
+    Serial.print(F("float   us/sample="));
+    Serial.print((float)floatUs / SAMPLES, 1);
+    Serial.print(F(" cycles/sample="));
+    Serial.println(floatUs * (F_CPU / 1000000UL) / SAMPLES);
+
+    Serial.print(F("integer us/sample="));
+    Serial.print((float)intUs / SAMPLES, 1);
+    Serial.print(F(" cycles/sample="));
+    Serial.println(intUs * (F_CPU / 1000000UL) / SAMPLES);
+
+    Serial.print(F("final z1="));
+    Serial.print(znRounded1dp, 1);
+    Serial.print(F(" sink="));
+    Serial.println(sink);
+}
+
+void loop()
+{
+}
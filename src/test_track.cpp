@@ -0,0 +1,103 @@
+#include <Arduino.h>
+#include "TripConfiguration/TripTrackRecorder.h"
+
+// =====================================================
+// TrackSimplifier: điểm phát ra ở các trường hợp biên
+//
+// - nhảy xa: 2 điểm cách nhau > MAX_SPAN ngay sau anchor (cửa sổ rỗng,
+//   vd mất fix lâu) → điểm thứ 2 phải được phát nguyên vẹn, không đọc
+//   ngoài cửa sổ
+// - đường thẳng: các điểm thẳng hàng chỉ giữ điểm đầu + điểm cuối
+// - nhảy xa giữa chừng rồi chạy tiếp bình thường
+//
+// Build riêng (đổi src_filter sang +<test_track.cpp>), Serial 115200.
+// =====================================================
+
+static const uint16_t TOLERANCE = 4;
+static const uint16_t COS_LAT_Q15 = 32768;
+
+TrackSimplifier simplifier;
+
+static uint8_t pass = 0, total = 0;
+
+static void report(const __FlashStringHelper *name, bool ok)
+{
+    total++;
+    pass += ok;
+    Serial.print(name);
+    Serial.println(ok ? F(" PASS") : F(" FAIL"));
+}
+
+static bool samePoint(const TrackPoint &a, const TrackPoint &b)
+{
+    return a.lat5 == b.lat5 && a.lon5 == b.lon5 && a.tS == b.tS;
+}
+
+static void testJumpFromAnchor()
+{
+    simplifier.reset(TOLERANCE, COS_LAT_Q15);
+    TrackPoint a = {1085766, 10676659, 0};
+    TrackPoint b = {a.lat5 + TrackSimplifier::MAX_SPAN + 1000, a.lon5, 600};
+    TrackPoint out;
+
+    bool first = simplifier.push(a, out) && samePoint(out, a);
+    bool second = simplifier.push(b, out) && samePoint(out, b);
+    bool nothingLeft = !simplifier.flush(out);
+    report(F("jump from anchor"), first && second && nothingLeft);
+}
+
+static void testStraightLine()
+{
+    simplifier.reset(TOLERANCE, COS_LAT_Q15);
+    TrackPoint out;
+    uint8_t emitted = 0;
+    TrackPoint last = {0, 0, 0};
+    for (uint8_t i = 0; i < 10; ++i)
+    {
+        last = {1085766L + i * 100L, 10676659L + i * 50L, i};
+        if (simplifier.push(last, out))
+            emitted++;
+    }
+    bool tail = simplifier.flush(out) && samePoint(out, last);
+    report(F("straight line"), emitted == 1 && tail);
+}
+
+static void testJumpMidTrack()
+{
+    simplifier.reset(TOLERANCE, COS_LAT_Q15);
+    TrackPoint out;
+    TrackPoint a = {1085766, 10676659, 0};
+    TrackPoint b = {1085866, 10676659, 1};
+    TrackPoint far = {b.lat5 + 2 * TrackSimplifier::MAX_SPAN, b.lon5, 900};
+    TrackPoint next = {far.lat5 + 100, far.lon5, 901};
+
+    bool ok = simplifier.push(a, out);
+    ok = ok && !simplifier.push(b, out);
+    // cửa sổ có b → phát b, far mở cửa sổ mới
+    ok = ok && simplifier.push(far, out) && samePoint(out, b);
+    // anchor b vẫn cách next > MAX_SPAN → far thành anchor
+    ok = ok && simplifier.push(next, out) && samePoint(out, far);
+    ok = ok && simplifier.flush(out) && samePoint(out, next);
+    report(F("jump mid track"), ok);
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial) {}
+
+    Serial.println(F("=== TrackSimplifier edge cases ==="));
+
+    testJumpFromAnchor();
+    testStraightLine();
+    testJumpMidTrack();
+
+    Serial.print(F("passed "));
+    Serial.print(pass);
+    Serial.print(F("/"));
+    Serial.println(total);
+}
+
+void loop()
+{
+}